@@ -1,6 +1,7 @@
 #ifndef MPM_CELL_H_
 #define MPM_CELL_H_
 
+#include <array>
 #include <limits>
 #include <map>
 #include <memory>
@@ -16,6 +17,7 @@
 #include "geometry.h"
 #include "logger.h"
 #include "map.h"
+#include "mutex.h"
 #include "node_base.h"
 #include "quadrature.h"
 
@@ -30,9 +32,21 @@ class Cell {
   //! Define a vector of size dimension
   using VectorDim = Eigen::Matrix<double, Tdim, 1>;
 
+  //! Cells hold fixed-size Eigen members (centroid, bounding box), so
+  //! dynamic allocations must honour Eigen's alignment requirements for
+  //! vectorized loads
+  EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+
   //! Define DOFs
   static const unsigned Tdof = (Tdim == 1) ? 1 : 3 * (Tdim - 1);
 
+  //! Cell status flags packed into a single word
+  enum CellFlags : uint8_t {
+    kIsoparametric = 1 << 0,
+    kSolvingStatus = 1 << 1,
+    kFreeSurface = 1 << 2
+  };
+
   //! Constructor with id, number of nodes and element
   //! \param[in] id Global cell id
   //! \param[in] nnodes Number of nodes per cell
@@ -84,22 +98,18 @@ class Cell {
   bool status() const { return particles_.size(); }
 
   //! Return particles_
-  std::vector<Index> particles() const { return particles_; }
+  const std::vector<Index>& particles() const { return particles_; }
 
   //! Number of nodes
   unsigned nnodes() const { return nodes_.size(); }
 
   //! Return nodes of the cell
-  std::vector<std::shared_ptr<mpm::NodeBase<Tdim>>> nodes() const {
-    return nodes_;
-  }
+  //! \brief Non-owning view of the cell nodes; ownership remains with the mesh
+  const std::vector<mpm::NodeBase<Tdim>*>& nodes() const { return nodes_; }
 
   //! Return nodes id in a cell
-  std::set<mpm::Index> nodes_id() const {
-    std::set<mpm::Index> nodes_id_lists;
-    for (const auto& node : nodes_) nodes_id_lists.insert(node->id());
-    return nodes_id_lists;
-  }
+  //! \brief Cached set maintained by add_node; avoids rebuilding per call
+  const std::set<mpm::Index>& nodes_id() const { return nodes_id_; }
 
   //! Side node pair ids
   std::vector<std::array<mpm::Index, 2>> side_node_pairs() const;
@@ -131,7 +141,7 @@ class Cell {
   unsigned nneighbours() const { return neighbours_.size(); }
 
   //! Return neighbour ids
-  std::set<mpm::Index> neighbours() const { return neighbours_; }
+  const std::vector<mpm::Index>& neighbours() const { return neighbours_; }
 
   //! Add an id of a particle in the cell
   //! \param[in] id Global id of a particle
@@ -158,7 +168,9 @@ class Cell {
   Eigen::Matrix<double, Tdim, 1> centroid() const { return centroid_; }
 
   //! Return the dN/dx at the centroid of the cell
-  Eigen::MatrixXd dn_dx_centroid() const { return dn_dx_centroid_; }
+  const Eigen::MatrixXd& dn_dx_centroid() const noexcept {
+    return dn_dx_centroid_;
+  }
 
   //! Compute mean length of cell
   void compute_mean_length();
@@ -167,12 +179,16 @@ class Cell {
   double mean_length() const { return mean_length_; }
 
   //! Return nodal coordinates
-  Eigen::MatrixXd nodal_coordinates() const { return nodal_coordinates_; }
+  //! The matrix is kept current by add_node, so hot-loop callers can bind a
+  //! reference instead of copying an nnodes x Tdim matrix per call
+  const Eigen::MatrixXd& nodal_coordinates() const noexcept {
+    return nodal_coordinates_;
+  }
 
   //! Check if a point is in a cartesian cell by checking the domain ranges
   //! \param[in] point Coordinates of point
   inline bool point_in_cartesian_cell(
-      const Eigen::Matrix<double, Tdim, 1>& point);
+      const Eigen::Matrix<double, Tdim, 1>& point) noexcept;
 
   //! Check if a point is in a isoparametric cell
   //! Use an affine transformation and NR to check if a transformed point is in
@@ -189,7 +205,7 @@ class Cell {
   //! \param[in] point Coordinates of a point
   //! \retval xi Local coordinates of a point
   inline Eigen::Matrix<double, Tdim, 1> local_coordinates_point(
-      const Eigen::Matrix<double, Tdim, 1>& point);
+      const Eigen::Matrix<double, Tdim, 1>& point) noexcept;
 
   //! Return the local coordinates of a point in a unit cell
   //! Using newton iteration / affine transformation
@@ -237,8 +253,9 @@ class Cell {
   //! \param[in] pvolume particle volume
   //! \param[in] multiplier multiplier
   void compute_local_material_stiffness_matrix(
-      const Eigen::MatrixXd& bmatrix, const Eigen::MatrixXd& dmatrix,
-      double pvolume, double multiplier = 1.0) noexcept;
+      const Eigen::Ref<const Eigen::MatrixXd>& bmatrix,
+      const Eigen::Ref<const Eigen::MatrixXd>& dmatrix, double pvolume,
+      double multiplier = 1.0) noexcept;
 
   //! Compute local geometric stiffness matrix (Used in equilibrium equation)
   //! \ingroup Implicit
@@ -247,16 +264,17 @@ class Cell {
   //! \param[in] pvolume particle volume
   //! \param[in] multiplier multiplier
   void compute_local_geometric_stiffness_matrix(
-      const Eigen::MatrixXd& geometric_stiffness, double pvolume,
-      double multiplier = 1.0) noexcept;
+      const Eigen::Ref<const Eigen::MatrixXd>& geometric_stiffness,
+      double pvolume, double multiplier = 1.0) noexcept;
 
   //! Compute local mass matrix (Used in equilibrium equation)
   //! \ingroup Implicit
   //! \param[in] shapefn shape function
   //! \param[in] pvolume particle volume
   //! \param[in] multiplier multiplier
-  void compute_local_mass_matrix(const Eigen::VectorXd& shapefn, double pvolume,
-                                 double multiplier = 1.0) noexcept;
+  void compute_local_mass_matrix(
+      const Eigen::Ref<const Eigen::VectorXd>& shapefn, double pvolume,
+      double multiplier = 1.0) noexcept;
   /**@}*/
 
   /**
@@ -267,22 +285,26 @@ class Cell {
   //! Assign solving status
   //! \ingroup MultiPhase
   //! \param[in] status Cell solving status for parallel free-surface detection
-  void assign_solving_status(bool status) { solving_status_ = status; }
+  void assign_solving_status(bool status) {
+    flags_ = status ? (flags_ | kSolvingStatus) : (flags_ & ~kSolvingStatus);
+  }
 
   //! Return solving status of a cell: active (if a particle is present in all
   //! MPI rank)
   //! \ingroup MultiPhase
-  bool solving_status() const { return solving_status_; }
+  bool solving_status() const { return (flags_ & kSolvingStatus) != 0; }
 
   //! Assign free surface
   //! \ingroup MultiPhase
   //! \param[in] free_surface boolean indicating free surface cell
-  void assign_free_surface(bool free_surface) { free_surface_ = free_surface; };
+  void assign_free_surface(bool free_surface) {
+    flags_ = free_surface ? (flags_ | kFreeSurface) : (flags_ & ~kFreeSurface);
+  };
 
   //! Return free surface bool
   //! \ingroup MultiPhase
-  //! \retval free_surface_ indicating free surface cell
-  bool free_surface() const { return free_surface_; };
+  //! \retval free_surface indicating free surface cell
+  bool free_surface() const { return (flags_ & kFreeSurface) != 0; };
 
   //! Assign volume traction to node
   //! \ingroup MultiPhase
@@ -326,8 +348,9 @@ class Cell {
   //! \param[in] shapefn Shape function
   //! \param[in] pvolume Volume weight
   //! \param[in] multiplier Drag force multiplier
-  void compute_local_drag_matrix(const Eigen::VectorXd& shapefn, double pvolume,
-                                 const VectorDim& multiplier) noexcept;
+  void compute_local_drag_matrix(
+      const Eigen::Ref<const Eigen::VectorXd>& shapefn, double pvolume,
+      const VectorDim& multiplier) noexcept;
 
   //! Return local laplacian
   //! \ingroup MultiPhase
@@ -338,9 +361,9 @@ class Cell {
   //! \param[in] grad_shapefn shape function gradient
   //! \param[in] pvolume volume weight
   //! \param[in] multiplier multiplier
-  void compute_local_laplacian(const Eigen::MatrixXd& grad_shapefn,
-                               double pvolume,
-                               double multiplier = 1.0) noexcept;
+  void compute_local_laplacian(
+      const Eigen::Ref<const Eigen::MatrixXd>& grad_shapefn, double pvolume,
+      double multiplier = 1.0) noexcept;
 
   //! Return local laplacian RHS matrix
   //! \ingroup MultiPhase
@@ -360,10 +383,23 @@ class Cell {
   //! \param[in] shapefn shape function
   //! \param[in] grad_shapefn shape function gradient
   //! \param[in] pvolume volume weight
-  void compute_local_poisson_right(const Eigen::VectorXd& shapefn,
-                                   const Eigen::MatrixXd& grad_shapefn,
-                                   double pvolume,
-                                   double multiplier = 1.0) noexcept;
+  void compute_local_poisson_right(
+      const Eigen::Ref<const Eigen::VectorXd>& shapefn,
+      const Eigen::Ref<const Eigen::MatrixXd>& grad_shapefn, double pvolume,
+      double multiplier = 1.0) noexcept;
+
+  //! Compute local poisson RHS and correction matrices in a single pass
+  //! Both matrices accumulate the same shapefn x grad_shapefn outer product,
+  //! so fusing the updates shares the product and the lock acquisition
+  //! \ingroup MultiPhase
+  //! \param[in] shapefn shape function
+  //! \param[in] grad_shapefn shape function gradient
+  //! \param[in] pvolume volume weight
+  //! \param[in] multiplier multiplier applied to the poisson RHS term
+  void compute_local_poisson_right_and_correction(
+      const Eigen::Ref<const Eigen::VectorXd>& shapefn,
+      const Eigen::Ref<const Eigen::MatrixXd>& grad_shapefn, double pvolume,
+      double multiplier = 1.0) noexcept;
 
   //! Compute local poisson RHS matrix (Used in poisson equation)
   //! \ingroup MultiPhase
@@ -371,11 +407,10 @@ class Cell {
   //! \param[in] shapefn shape function
   //! \param[in] grad_shapefn shape function gradient
   //! \param[in] pvolume volume weight
-  void compute_local_poisson_right_twophase(unsigned phase,
-                                            const Eigen::VectorXd& shapefn,
-                                            const Eigen::MatrixXd& grad_shapefn,
-                                            double pvolume,
-                                            double multiplier = 1.0) noexcept;
+  void compute_local_poisson_right_twophase(
+      unsigned phase, const Eigen::Ref<const Eigen::VectorXd>& shapefn,
+      const Eigen::Ref<const Eigen::MatrixXd>& grad_shapefn, double pvolume,
+      double multiplier = 1.0) noexcept;
 
   //! Return local correction matrix
   //! \ingroup MultiPhase
@@ -393,9 +428,10 @@ class Cell {
   //! \param[in] shapefn shape function
   //! \param[in] grad_shapefn shape function gradient
   //! \param[in] pvolume volume weight
-  void compute_local_correction_matrix(const Eigen::VectorXd& shapefn,
-                                       const Eigen::MatrixXd& grad_shapefn,
-                                       double pvolume) noexcept;
+  void compute_local_correction_matrix(
+      const Eigen::Ref<const Eigen::VectorXd>& shapefn,
+      const Eigen::Ref<const Eigen::MatrixXd>& grad_shapefn,
+      double pvolume) noexcept;
 
   //! Compute local correction matrix for two phase (Used to correct velocity)
   //! \ingroup MultiPhase
@@ -404,8 +440,8 @@ class Cell {
   //! \param[in] grad_shapefn shape function gradient
   //! \param[in] pvolume volume weight
   void compute_local_correction_matrix_twophase(
-      unsigned phase, const Eigen::VectorXd& shapefn,
-      const Eigen::MatrixXd& grad_shapefn, double pvolume,
+      unsigned phase, const Eigen::Ref<const Eigen::VectorXd>& shapefn,
+      const Eigen::Ref<const Eigen::MatrixXd>& grad_shapefn, double pvolume,
       double multiplier = 1.0) noexcept;
 
   /**@}*/
@@ -440,25 +476,37 @@ class Cell {
  private:
   //! Approximately check if a point is in a cell
   //! \param[in] point Coordinates of point
-  bool approx_point_in_cell(const Eigen::Matrix<double, Tdim, 1>& point);
+  bool approx_point_in_cell(
+      const Eigen::Matrix<double, Tdim, 1>& point) noexcept;
+
+  //! Return the class logger shared by all cells of this dimension
+  static spdlog::logger* console();
 
  private:
   //! Mutex
-  std::mutex cell_mutex_;
+  SpinMutex cell_mutex_;
   //! cell id
   Index id_{std::numeric_limits<Index>::max()};
   //! MPI Rank
   unsigned rank_{0};
   //! Previous MPI Rank
   unsigned previous_mpirank_{0};
-  //! Isoparametric
-  bool isoparametric_{true};
+  //! Packed status flags (isoparametric / solving / free surface)
+  //! One byte instead of a padded bool per flag keeps the hot header of the
+  //! cell compact for the grid loops
+  uint8_t flags_{kIsoparametric};
   //! Number of nodes
   unsigned nnodes_{0};
   //! Volume
   double volume_{std::numeric_limits<double>::lowest()};
   //! Centroid
   VectorDim centroid_;
+  //! Bounding box of the cell corner nodes, cached at initialise
+  VectorDim bbox_min_;
+  //! Bounding box of the cell corner nodes, cached at initialise
+  VectorDim bbox_max_;
+  //! Reciprocal of the bounding box extents, cached at initialise
+  VectorDim bbox_inv_extent_;
   //! mean_length of cell
   double mean_length_{std::numeric_limits<double>::max()};
   //! particles ids in cell
@@ -466,24 +514,25 @@ class Cell {
   //! Number of global nparticles
   unsigned nglobal_particles_{0};
   //! Container of node pointers (local id, node pointer)
-  std::vector<std::shared_ptr<NodeBase<Tdim>>> nodes_;
-  //! Nodal coordinates
+  //! Non-owning raw pointers sized to nnodes; node ownership stays in the mesh
+  std::vector<NodeBase<Tdim>*> nodes_;
+  //! Cached node ids of the cell, maintained by add_node
+  std::set<mpm::Index> nodes_id_;
+  //! Nodal coordinates (nnodes x Tdim, column-major: contiguous per axis)
   Eigen::MatrixXd nodal_coordinates_;
-  //! Container of cell neighbour ids
-  std::set<mpm::Index> neighbours_;
+  //! Container of cell neighbour ids, kept sorted and unique
+  //! A contiguous vector: neighbour counts are small (<= 26 in 3D), so a
+  //! sorted scan beats the per-node heap layout of std::set
+  std::vector<mpm::Index> neighbours_;
   //! Shape function
   std::shared_ptr<Element<Tdim>> element_{nullptr};
   //! Quadrature
   std::shared_ptr<Quadrature<Tdim>> quadrature_{nullptr};
   //! dN/dx
   Eigen::MatrixXd dn_dx_centroid_;
-  //! Velocity constraints
-  //! key: face_id, value: pair of direction [0/1/2] and velocity value
-  std::map<unsigned, std::vector<std::pair<unsigned, double>>>
-      velocity_constraints_;
-  //! Normal of face
-  //! first-> face_id, second->vector of the normal
-  std::map<unsigned, Eigen::VectorXd> face_normals_;
+  //! Normal of face, indexed by face_id
+  //! Face ids are dense [0, nfaces), so a contiguous vector replaces the map
+  std::vector<Eigen::Matrix<double, Tdim, 1>> face_normals_;
 
   /**
    * \defgroup ImplicitVariables Variables for single-phase implicit
@@ -498,10 +547,6 @@ class Cell {
    * \defgroup MultiPhaseVariables Variables for multi-phase MPM
    * @{
    */
-  //! Solving status
-  bool solving_status_{false};
-  //! Free surface bool
-  bool free_surface_{false};
   //! Volume fraction
   double volume_fraction_{0.0};
   //! Local laplacian matrix
@@ -510,16 +555,13 @@ class Cell {
   Eigen::MatrixXd poisson_right_matrix_;
   //! Local correction RHS matrix
   Eigen::MatrixXd correction_matrix_;
-  //! Drag force coefficient
-  std::vector<Eigen::MatrixXd> drag_matrix_;
-  //! Local poisson RHS matrix for twophase
-  std::vector<Eigen::MatrixXd> poisson_right_matrix_twophase_;
-  //! Local poisson RHS matrix for twophase
-  std::vector<Eigen::MatrixXd> correction_matrix_twophase_;
+  //! Drag force coefficient, one matrix per direction
+  std::array<Eigen::MatrixXd, Tdim> drag_matrix_;
+  //! Local poisson RHS matrix for twophase, one matrix per phase
+  std::array<Eigen::MatrixXd, 2> poisson_right_matrix_twophase_;
+  //! Local correction RHS matrix for twophase, one matrix per phase
+  std::array<Eigen::MatrixXd, 2> correction_matrix_twophase_;
   /**@}*/
-
-  //! Logger
-  std::unique_ptr<spdlog::logger> console_;
 };  // Cell class
 }  // namespace mpm
 
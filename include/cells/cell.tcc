@@ -1,20 +1,30 @@
+//! Return the class logger shared by all cells of this dimension
+template <unsigned Tdim>
+spdlog::logger* mpm::Cell<Tdim>::console() {
+  // A single logger per template instantiation; a per-cell logger would
+  // cost a heap allocation for every cell of the mesh
+  static const auto console = std::make_unique<spdlog::logger>(
+      "cell" + std::to_string(Tdim) + "d", mpm::stdout_sink);
+  return console.get();
+}
+
 //! Constructor with cell id, number of nodes and element
 template <unsigned Tdim>
 mpm::Cell<Tdim>::Cell(Index id, unsigned nnodes,
                       const std::shared_ptr<Element<Tdim>>& elementptr,
                       bool isoparametric)
-    : id_{id}, nnodes_{nnodes}, isoparametric_{isoparametric} {
+    : id_{id},
+      nnodes_{nnodes},
+      flags_{static_cast<uint8_t>(isoparametric ? kIsoparametric : 0)} {
   // Check if the dimension is between 1 & 3
   static_assert((Tdim >= 1 && Tdim <= 3), "Invalid global dimension");
 
-  //! Logger
-  std::string logger =
-      "cell" + std::to_string(Tdim) + "d::" + std::to_string(id);
-  console_ = std::make_unique<spdlog::logger>(logger, mpm::stdout_sink);
-
   try {
     if (elementptr->nfunctions() == this->nnodes_) {
       element_ = elementptr;
+      // Number of nodes is fixed at construction; reserve once to keep the
+      // node pointer storage contiguous and allocation-free in add_node
+      nodes_.reserve(this->nnodes_);
       // Create an empty nodal coordinates
       nodal_coordinates_.resize(this->nnodes_, Tdim);
     } else {
@@ -22,7 +32,7 @@ mpm::Cell<Tdim>::Cell(Index id, unsigned nnodes,
           "Specified number of shape functions and nodes don't match");
     }
   } catch (std::exception& exception) {
-    console_->error("{} #{}: {}\n", __FILE__, __LINE__, exception.what());
+    console()->error("{} #{}: {}\n", __FILE__, __LINE__, exception.what());
   }
 }
 
@@ -38,6 +48,41 @@ bool mpm::Cell<Tdim>::initialise() {
       this->compute_mean_length();
       this->compute_volume();
 
+      // Cache the bounds for the cartesian containment test from the same
+      // corner nodes the per-dimension checks compared (0/1, 0/1/2 and
+      // 0/1/2/4), so skewed cells keep rejecting points that fall only
+      // inside their axis-aligned bounding box
+      Eigen::VectorXi corners = element_->corner_indices();
+      if (Tdim == 3 && nodal_coordinates_.rows() > 4) {
+        bbox_min_(0) = nodal_coordinates_(0, 0);
+        bbox_max_(0) = nodal_coordinates_(1, 0);
+        bbox_min_(1) = nodal_coordinates_(1, 1);
+        bbox_max_(1) = nodal_coordinates_(2, 1);
+        bbox_min_(2) = nodal_coordinates_(0, 2);
+        bbox_max_(2) = nodal_coordinates_(4, 2);
+      } else if (Tdim == 2) {
+        bbox_min_(0) = nodal_coordinates_(0, 0);
+        bbox_max_(0) = nodal_coordinates_(1, 0);
+        bbox_min_(1) = nodal_coordinates_(1, 1);
+        bbox_max_(1) = nodal_coordinates_(2, 1);
+      } else if (Tdim == 1) {
+        bbox_min_(0) = nodal_coordinates_(0, 0);
+        bbox_max_(0) = nodal_coordinates_(1, 0);
+      } else {
+        // Tetrahedra have no node 4; fall back to the corner-node extents
+        bbox_min_ = nodal_coordinates_.row(corners(0)).transpose();
+        bbox_max_ = bbox_min_;
+        for (unsigned i = 1; i < corners.size(); ++i) {
+          const VectorDim corner =
+              nodal_coordinates_.row(corners(i)).transpose();
+          bbox_min_ = bbox_min_.cwiseMin(corner);
+          bbox_max_ = bbox_max_.cwiseMax(corner);
+        }
+      }
+      // Reciprocal extents for the cartesian real-to-unit transform; the
+      // positive-volume check above guarantees non-degenerate extents
+      bbox_inv_extent_ = (bbox_max_ - bbox_min_).cwiseInverse();
+
       // Get centroid of a cell in natural coordinates which are zeros
       Eigen::Matrix<double, Tdim, 1> xi_centroid;
       xi_centroid.setZero();
@@ -57,7 +102,7 @@ bool mpm::Cell<Tdim>::initialise() {
           "Specified number of nodes for a cell is not present");
     }
   } catch (std::exception& exception) {
-    console_->error("{} #{}: {}\n", __FILE__, __LINE__, exception.what());
+    console()->error("{} #{}: {}\n", __FILE__, __LINE__, exception.what());
   }
   return status;
 }
@@ -132,7 +177,7 @@ std::vector<Eigen::Matrix<double, Tdim, 1>> mpm::Cell<Tdim>::generate_points() {
     if (status)
       points.emplace_back(point);
     else
-      console_->warn("Cannot generate point: ({}, {}) in cell xi: ({}, {})",
+      console()->warn("Cannot generate point: ({}, {}) in cell xi: ({}, {})",
                      point(0), point(1), xi(0), xi(1));
   }
 
@@ -149,7 +194,9 @@ bool mpm::Cell<Tdim>::add_node(
     // per cell
     // The local id should be between 0 and maximum number of nodes
     if (nodes_.size() < this->nnodes_ && local_id < this->nnodes_) {
-      nodes_.emplace_back(node_ptr);
+      // Store a non-owning pointer; the mesh retains ownership of the node
+      nodes_.emplace_back(node_ptr.get());
+      nodes_id_.insert(node_ptr->id());
       // Assign coordinates
       nodal_coordinates_.row(local_id) =
           nodes_[local_id]->coordinates().transpose();
@@ -159,7 +206,7 @@ bool mpm::Cell<Tdim>::add_node(
           "Number nodes in a cell exceeds the maximum allowed per cell");
     }
   } catch (std::exception& exception) {
-    console_->error("{} #{}: {}\n", __FILE__, __LINE__, exception.what());
+    console()->error("{} #{}: {}\n", __FILE__, __LINE__, exception.what());
   }
   return insertion_status;
 }
@@ -169,7 +216,7 @@ template <unsigned Tdim>
 void mpm::Cell<Tdim>::activate_nodes() {
   // If number of particles are present, set all associated nodes as active
   if (particles_.size() > 0) {
-    // std::lock_guard<std::mutex> guard(cell_mutex_);
+    // std::lock_guard<mpm::SpinMutex> guard(cell_mutex_);
     for (unsigned i = 0; i < nodes_.size(); ++i) nodes_[i]->assign_status(true);
   }
 }
@@ -182,6 +229,7 @@ std::vector<std::array<mpm::Index, 2>> mpm::Cell<Tdim>::side_node_pairs()
   std::vector<std::array<mpm::Index, 2>> node_pairs;
   // Get the indices of sides
   Eigen::MatrixXi indices = element_->sides_indices();
+  node_pairs.reserve(indices.rows());
   // Iterate over indices and get node ids
   for (unsigned i = 0; i < indices.rows(); ++i)
     node_pairs.emplace_back(std::array<mpm::Index, 2>(
@@ -196,13 +244,19 @@ bool mpm::Cell<Tdim>::add_neighbour(mpm::Index neighbour_id) {
   bool insertion_status = false;
   try {
     // If cell id is not the same as the current cell
-    if (neighbour_id != this->id())
-      insertion_status = (neighbours_.insert(neighbour_id)).second;
-    else
+    if (neighbour_id != this->id()) {
+      // Sorted insert keeps the neighbour list unique and binary-searchable
+      auto itr =
+          std::lower_bound(neighbours_.begin(), neighbours_.end(), neighbour_id);
+      if (itr == neighbours_.end() || *itr != neighbour_id) {
+        neighbours_.insert(itr, neighbour_id);
+        insertion_status = true;
+      }
+    } else
       throw std::runtime_error("Invalid local id of a cell neighbour");
 
   } catch (std::exception& exception) {
-    console_->error("{} {}: {}\n", __FILE__, __LINE__, exception.what());
+    console()->error("{} {}: {}\n", __FILE__, __LINE__, exception.what());
   }
   return insertion_status;
 }
@@ -211,11 +265,12 @@ bool mpm::Cell<Tdim>::add_neighbour(mpm::Index neighbour_id) {
 template <unsigned Tdim>
 bool mpm::Cell<Tdim>::add_particle_id(Index id) {
   bool status = false;
-  std::lock_guard<std::mutex> guard(cell_mutex_);
-  // Check if it is found in the container
-  auto itr = std::find(particles_.begin(), particles_.end(), id);
-  if (itr == particles_.end()) {
-    particles_.emplace_back(id);
+  std::lock_guard<mpm::SpinMutex> guard(cell_mutex_);
+  // Particle ids are kept sorted so membership checks and removals are a
+  // binary search instead of a linear scan over all particles in the cell
+  auto itr = std::lower_bound(particles_.begin(), particles_.end(), id);
+  if (itr == particles_.end() || *itr != id) {
+    particles_.insert(itr, id);
     status = true;
   }
   return status;
@@ -224,9 +279,9 @@ bool mpm::Cell<Tdim>::add_particle_id(Index id) {
 //! Remove a particle id
 template <unsigned Tdim>
 void mpm::Cell<Tdim>::remove_particle_id(Index id) {
-  std::lock_guard<std::mutex> guard(cell_mutex_);
-  particles_.erase(std::remove(particles_.begin(), particles_.end(), id),
-                   particles_.end());
+  std::lock_guard<mpm::SpinMutex> guard(cell_mutex_);
+  auto itr = std::lower_bound(particles_.begin(), particles_.end(), id);
+  if (itr != particles_.end() && *itr == id) particles_.erase(itr);
 }
 
 //! Compute volume of a 2D cell
@@ -244,7 +299,7 @@ inline void mpm::Cell<Tdim>::compute_volume() {
       throw std::runtime_error(
           "Negative or zero volume cell, misconfigured cell!");
   } catch (std::exception& exception) {
-    console_->error("{} #{}: {}\n", __FILE__, __LINE__, exception.what());
+    console()->error("{} #{}: {}\n", __FILE__, __LINE__, exception.what());
   }
 }
 
@@ -276,51 +331,23 @@ void mpm::Cell<Tdim>::compute_mean_length() {
   this->mean_length_ /= indices.rows();
 }
 
-//! Check if a point is in a 1D cell by checking bounding box range
-template <>
-inline bool mpm::Cell<1>::point_in_cartesian_cell(
-    const Eigen::Matrix<double, 1, 1>& point) {
-  if (nodes_[0]->coordinates()(0) <= point(0) &&
-      nodes_[1]->coordinates()(0) >= point(0))
-    return true;
-  else
-    return false;
-}
-
-//! Check if a point is in a 2D cell by checking bounding box range
-template <>
-inline bool mpm::Cell<2>::point_in_cartesian_cell(
-    const Eigen::Matrix<double, 2, 1>& point) {
-  // Check if a point is within x and y ranges
-  if (nodes_[0]->coordinates()(0) <= point(0) &&
-      nodes_[1]->coordinates()(0) >= point(0) &&
-      nodes_[1]->coordinates()(1) <= point(1) &&
-      nodes_[2]->coordinates()(1) >= point(1))
-    return true;
-  else
-    return false;
-}
-
-//! Check if a point is in a 3D cell by checking bounding box range
-template <>
-inline bool mpm::Cell<3>::point_in_cartesian_cell(
-    const Eigen::Matrix<double, 3, 1>& point) {
-  // Check if a point is within x, y and z ranges
-  if (nodes_[0]->coordinates()(0) <= point(0) &&
-      nodes_[1]->coordinates()(0) >= point(0) &&
-      nodes_[1]->coordinates()(1) <= point(1) &&
-      nodes_[2]->coordinates()(1) >= point(1) &&
-      nodes_[0]->coordinates()(2) <= point(2) &&
-      nodes_[4]->coordinates()(2) >= point(2))
-    return true;
-  else
-    return false;
+//! Check if a point is in a cartesian cell by checking bounding box range
+template <unsigned Tdim>
+inline bool mpm::Cell<Tdim>::point_in_cartesian_cell(
+    const Eigen::Matrix<double, Tdim, 1>& point) noexcept {
+  // Accumulate the per-axis range checks with bitwise AND so the test is
+  // branchless; particles near cell walls otherwise mispredict heavily in
+  // the locate loop
+  bool inside = true;
+  for (unsigned i = 0; i < Tdim; ++i)
+    inside &= (bbox_min_(i) <= point(i)) & (point(i) <= bbox_max_(i));
+  return inside;
 }
 
 //! Check approximately if a point is in a cell by using cell length
 template <unsigned Tdim>
 inline bool mpm::Cell<Tdim>::approx_point_in_cell(
-    const Eigen::Matrix<double, Tdim, 1>& point) {
+    const Eigen::Matrix<double, Tdim, 1>& point) noexcept {
   const double length = (point - this->centroid_).norm();
   if (length < (this->mean_length_ * 2.))
     return true;
@@ -343,7 +370,7 @@ inline bool mpm::Cell<Tdim>::is_point_in_cell(
   bool status = true;
 
   // Check if cell is cartesian, if so use cartesian local coordinates
-  if (!isoparametric_) (*xi) = this->local_coordinates_point(point);
+  if (!(flags_ & kIsoparametric)) (*xi) = this->local_coordinates_point(point);
   // Isoparametric element
   else
     (*xi) = this->transform_real_to_unit_cell(point);
@@ -384,7 +411,7 @@ inline bool mpm::Cell<Tdim>::is_point_in_cell(
 //! Return the local coordinates of a point in a 1D cell
 template <>
 inline Eigen::Matrix<double, 1, 1> mpm::Cell<1>::local_coordinates_point(
-    const Eigen::Matrix<double, 1, 1>& point) {
+    const Eigen::Matrix<double, 1, 1>& point) noexcept {
   // Local point coordinates
   Eigen::Matrix<double, 1, 1> xi;
 
@@ -397,21 +424,13 @@ inline Eigen::Matrix<double, 1, 1> mpm::Cell<1>::local_coordinates_point(
       //
       // 0 0---------0 1
       //        l
-      const double length = (nodes_[indices(0)]->coordinates() -
-                             nodes_[indices(1)]->coordinates())
-                                .norm();
-
-      const Eigen::Matrix<double, 1, 1> centre =
-          (nodes_[indices(0)]->coordinates() +
-           nodes_[indices(1)]->coordinates()) /
-          2.0;
-
-      xi(0) = 2. * (point(0) - centre(0)) / length;
+      // Cartesian map from the cached bounding box: xi = 2(x - centre) / l
+      xi = (2. * point - bbox_min_ - bbox_max_).cwiseProduct(bbox_inv_extent_);
     } else {
       throw std::runtime_error("Unable to compute local coordinates");
     }
   } catch (std::exception& exception) {
-    console_->error("{} #{}: {}\n", __FILE__, __LINE__, exception.what());
+    console()->error("{} #{}: {}\n", __FILE__, __LINE__, exception.what());
   }
   return xi;
 }
@@ -419,7 +438,7 @@ inline Eigen::Matrix<double, 1, 1> mpm::Cell<1>::local_coordinates_point(
 //! Return the local coordinates of a point in a 2D cell
 template <>
 inline Eigen::Matrix<double, 2, 1> mpm::Cell<2>::local_coordinates_point(
-    const Eigen::Matrix<double, 2, 1>& point) {
+    const Eigen::Matrix<double, 2, 1>& point) noexcept {
   // Local point coordinates
   Eigen::Matrix<double, 2, 1> xi;
 
@@ -464,23 +483,14 @@ inline Eigen::Matrix<double, 2, 1> mpm::Cell<2>::local_coordinates_point(
       //   | /   \ |
       // 0 0---------0 1
       //         d
-      const double xlength =
-          (nodal_coordinates_.row(0) - nodal_coordinates_.row(1)).norm();
-      const double ylength =
-          (nodal_coordinates_.row(1) - nodal_coordinates_.row(2)).norm();
-
-      const Eigen::Matrix<double, 2, 1> centre =
-          (nodal_coordinates_.row(0) + nodal_coordinates_.row(1) +
-           nodal_coordinates_.row(2) + nodal_coordinates_.row(3)) /
-          4.0;
-
-      xi(0) = 2. * (point(0) - centre(0)) / xlength;
-      xi(1) = 2. * (point(1) - centre(1)) / ylength;
+      // Cartesian map from the cached bounding box: the edge lengths of an
+      // axis-aligned quadrilateral equal its bounding-box extents
+      xi = (2. * point - bbox_min_ - bbox_max_).cwiseProduct(bbox_inv_extent_);
     } else {
       throw std::runtime_error("Unable to compute local coordinates");
     }
   } catch (std::exception& exception) {
-    console_->error("{} #{}: {}\n", __FILE__, __LINE__, exception.what());
+    console()->error("{} #{}: {}\n", __FILE__, __LINE__, exception.what());
   }
   return xi;
 }
@@ -488,7 +498,7 @@ inline Eigen::Matrix<double, 2, 1> mpm::Cell<2>::local_coordinates_point(
 //! Return the local coordinates of a point in a 3D cell
 template <>
 inline Eigen::Matrix<double, 3, 1> mpm::Cell<3>::local_coordinates_point(
-    const Eigen::Matrix<double, 3, 1>& point) {
+    const Eigen::Matrix<double, 3, 1>& point) noexcept {
 
   // Local point coordinates
   Eigen::Matrix<double, 3, 1> xi;
@@ -574,30 +584,16 @@ inline Eigen::Matrix<double, 3, 1> mpm::Cell<3>::local_coordinates_point(
       //     4               5
       //
 
-      const double xlength =
-          (nodal_coordinates_.row(0) - nodal_coordinates_.row(1)).norm();
-      const double ylength =
-          (nodal_coordinates_.row(1) - nodal_coordinates_.row(2)).norm();
-      const double zlength =
-          (nodal_coordinates_.row(1) - nodal_coordinates_.row(5)).norm();
-
-      // Compute centre
-      Eigen::Matrix<double, 3, 1> centre;
-      centre.setZero();
-      for (unsigned i = 0; i < indices.size(); ++i)
-        centre.noalias() += nodal_coordinates_.row(i);
-      centre /= indices.size();
-
-      xi(0) = 2. * (point(0) - centre(0)) / xlength;
-      xi(1) = 2. * (point(1) - centre(1)) / ylength;
-      xi(2) = 2. * (point(2) - centre(2)) / zlength;
+      // Cartesian map from the cached bounding box: the edge lengths of an
+      // axis-aligned hexahedron equal its bounding-box extents
+      xi = (2. * point - bbox_min_ - bbox_max_).cwiseProduct(bbox_inv_extent_);
     }
     // Element not recognized
     else {
       throw std::runtime_error("Unable to compute local coordinates");
     }
   } catch (std::exception& exception) {
-    console_->error("{} #{}: {}\n", __FILE__, __LINE__, exception.what());
+    console()->error("{} #{}: {}\n", __FILE__, __LINE__, exception.what());
   }
   return xi;
 }
@@ -616,7 +612,7 @@ inline Eigen::Matrix<double, Tdim, 1>
         const Eigen::Matrix<double, Tdim, 1>& point) {
 
   // If regular cartesian grid use cartesian transformation
-  if (!this->isoparametric_) return this->local_coordinates_point(point);
+  if (!(flags_ & kIsoparametric)) return this->local_coordinates_point(point);
 
   // Get indices of corner nodes
   Eigen::VectorXi indices = element_->corner_indices();
@@ -834,6 +830,7 @@ template <>
 inline void mpm::Cell<2>::compute_normals() {
 
   //! Set number of faces from element
+  face_normals_.resize(element_->nfaces());
   for (unsigned face_id = 0; face_id < element_->nfaces(); ++face_id) {
     // Get the nodes of the face
     const Eigen::VectorXi indices = element_->face_indices(face_id);
@@ -850,10 +847,7 @@ inline void mpm::Cell<2>::compute_normals() {
     // of the element
     Eigen::Matrix<double, 2, 1> normal_vector;
     normal_vector << -a(1), a(0);
-    normal_vector = normal_vector.normalized();
-
-    face_normals_.insert(std::make_pair<unsigned, Eigen::VectorXd>(
-        static_cast<unsigned>(face_id), normal_vector));
+    face_normals_[face_id] = normal_vector.normalized();
   }
 }
 
@@ -862,6 +856,7 @@ template <>
 inline void mpm::Cell<3>::compute_normals() {
 
   //! Set number of faces from element
+  face_normals_.resize(element_->nfaces());
   for (unsigned face_id = 0; face_id < element_->nfaces(); ++face_id) {
     // Get the nodes of the face
     const Eigen::VectorXi indices = element_->face_indices(face_id);
@@ -879,10 +874,7 @@ inline void mpm::Cell<3>::compute_normals() {
     // Note that definition of a and b are such that normal is always out of
     // page
     Eigen::Matrix<double, 3, 1> normal_vector = a.cross(b);
-    normal_vector = normal_vector.normalized();
-
-    face_normals_.insert(std::make_pair<unsigned, Eigen::VectorXd>(
-        static_cast<unsigned>(face_id), normal_vector));
+    face_normals_[face_id] = normal_vector.normalized();
   }
 }
 
@@ -891,12 +883,14 @@ template <unsigned Tdim>
 inline std::vector<std::vector<mpm::Index>>
     mpm::Cell<Tdim>::sorted_face_node_ids() {
   std::vector<std::vector<mpm::Index>> set_face_nodes;
+  set_face_nodes.reserve(element_->nfaces());
   //! Set number of faces from element
   for (unsigned face_id = 0; face_id < element_->nfaces(); ++face_id) {
     std::vector<mpm::Index> face_nodes;
 
     // Get the nodes of the face
     const Eigen::VectorXi indices = element_->face_indices(face_id);
+    face_nodes.reserve(indices.size());
     for (int id = 0; id < indices.size(); ++id)
       face_nodes.emplace_back(nodes_[indices(id)]->id());
 
@@ -939,7 +933,7 @@ bool mpm::Cell<Tdim>::upgrade_status(unsigned new_nnodes) {
         Eigen::MatrixXd::Zero(this->nnodes_, Tdim));
   } else {
     status = false;
-    console_->warn(
+    console()->warn(
         "Upgrading cell id: {} fails. Cell is either not-compatible to upgrade "
         "or has been upgraded before.",
         this->id_);
@@ -991,7 +985,7 @@ bool mpm::Cell<Tdim>::initialiase_nonlocal(
     // Reinitialise cell
     status = initialise();
   } catch (std::exception& exception) {
-    console_->error("{} #{}: {}\n", __FILE__, __LINE__, exception.what());
+    console()->error("{} #{}: {}\n", __FILE__, __LINE__, exception.what());
   }
   return status;
 }
\ No newline at end of file
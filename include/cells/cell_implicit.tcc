@@ -5,11 +5,12 @@ bool mpm::Cell<Tdim>::initialise_element_stiffness_matrix() {
   if (this->status()) {
     try {
       // Initialse stiffness matrix ((N*Tdim)x(N*Tdim))
-      stiffness_matrix_.resize(nnodes_ * Tdim, nnodes_ * Tdim);
-      stiffness_matrix_.setZero();
+      // setZero(rows, cols) only reallocates when the dimensions change, so
+      // re-initialising an already-sized cell is free of malloc traffic
+      stiffness_matrix_.setZero(nnodes_ * Tdim, nnodes_ * Tdim);
 
     } catch (std::exception& exception) {
-      console_->error("{} #{}: {}\n", __FILE__, __LINE__, exception.what());
+      console()->error("{} #{}: {}\n", __FILE__, __LINE__, exception.what());
       status = false;
     }
   }
@@ -19,35 +20,46 @@ bool mpm::Cell<Tdim>::initialise_element_stiffness_matrix() {
 //! Compute local material stiffness matrix
 template <unsigned Tdim>
 void mpm::Cell<Tdim>::compute_local_material_stiffness_matrix(
-    const Eigen::MatrixXd& bmatrix, const Eigen::MatrixXd& dmatrix,
-    double pvolume, double multiplier) noexcept {
+    const Eigen::Ref<const Eigen::MatrixXd>& bmatrix,
+    const Eigen::Ref<const Eigen::MatrixXd>& dmatrix, double pvolume,
+    double multiplier) noexcept {
+
+  // Evaluate the weighted D * B product before taking the lock: the scalar
+  // weight is folded into the small (ncomponents x ndof) factor instead of
+  // the full ndof x ndof result, and only the accumulation is serialized
+  const Eigen::MatrixXd weighted_db =
+      dmatrix * bmatrix * (multiplier * pvolume);
 
-  std::lock_guard<std::mutex> guard(cell_mutex_);
-  stiffness_matrix_.noalias() +=
-      bmatrix.transpose() * dmatrix * bmatrix * multiplier * pvolume;
+  std::lock_guard<mpm::SpinMutex> guard(cell_mutex_);
+  stiffness_matrix_.noalias() += bmatrix.transpose() * weighted_db;
 }
 
 //! Compute local geometric stiffness matrix
 template <unsigned Tdim>
 void mpm::Cell<Tdim>::compute_local_geometric_stiffness_matrix(
-    const Eigen::MatrixXd& geometric_stiffness, double pvolume,
-    double multiplier) noexcept {
+    const Eigen::Ref<const Eigen::MatrixXd>& geometric_stiffness,
+    double pvolume, double multiplier) noexcept {
 
-  std::lock_guard<std::mutex> guard(cell_mutex_);
+  std::lock_guard<mpm::SpinMutex> guard(cell_mutex_);
   stiffness_matrix_.noalias() += geometric_stiffness * multiplier * pvolume;
 }
 
 //! Compute local mass matrix
 template <unsigned Tdim>
 inline void mpm::Cell<Tdim>::compute_local_mass_matrix(
-    const Eigen::VectorXd& shapefn, double pvolume,
+    const Eigen::Ref<const Eigen::VectorXd>& shapefn, double pvolume,
     double multiplier) noexcept {
 
-  std::lock_guard<std::mutex> guard(cell_mutex_);
+  std::lock_guard<mpm::SpinMutex> guard(cell_mutex_);
+  // Hoist the scalar weight so the diagonal update is a single FMA per dof;
+  // the iterations touch disjoint diagonal entries, so give the compiler
+  // license to vectorize
+  const double coeff = multiplier * pvolume;
+#pragma omp simd
   for (unsigned i = 0; i < this->nnodes_; ++i) {
+    const double mass = shapefn(i) * coeff;
     for (unsigned k = 0; k < Tdim; ++k) {
-      stiffness_matrix_(Tdim * i + k, Tdim * i + k) +=
-          shapefn(i) * multiplier * pvolume;
+      stiffness_matrix_(Tdim * i + k, Tdim * i + k) += mass;
     }
   }
 }
\ No newline at end of file
@@ -26,7 +26,7 @@ Eigen::VectorXi mpm::Cell<Tdim>::local_node_indices() {
       node_idx++;
     }
   } catch (std::exception& exception) {
-    console_->error("{} #{}: {}\n", __FILE__, __LINE__, exception.what());
+    console()->error("{} #{}: {}\n", __FILE__, __LINE__, exception.what());
   }
   return indices;
 }
@@ -37,20 +37,19 @@ bool mpm::Cell<Tdim>::initialise_element_matrix() {
   bool status = true;
   if (this->status()) {
     try {
+      // setZero(rows, cols) only reallocates when the dimensions change, so
+      // re-initialising an already-sized cell is free of malloc traffic
       // Initialse Laplacian matrix (NxN)
-      laplacian_matrix_.resize(nnodes_, nnodes_);
-      laplacian_matrix_.setZero();
+      laplacian_matrix_.setZero(nnodes_, nnodes_);
 
       // Initialse poisson RHS matrix (Nx(N*Tdim))
-      poisson_right_matrix_.resize(nnodes_, nnodes_ * Tdim);
-      poisson_right_matrix_.setZero();
+      poisson_right_matrix_.setZero(nnodes_, nnodes_ * Tdim);
 
       // Initialse correction RHS matrix (NxTdim)
-      correction_matrix_.resize(nnodes_, nnodes_ * Tdim);
-      correction_matrix_.setZero();
+      correction_matrix_.setZero(nnodes_, nnodes_ * Tdim);
 
     } catch (std::exception& exception) {
-      console_->error("{} #{}: {}\n", __FILE__, __LINE__, exception.what());
+      console()->error("{} #{}: {}\n", __FILE__, __LINE__, exception.what());
       status = false;
     }
   }
@@ -64,34 +63,24 @@ bool mpm::Cell<Tdim>::initialise_element_matrix_twophase() {
   if (this->status()) {
     try {
       // Initialise drag matrix
-      drag_matrix_.resize(Tdim);
-      for (unsigned dir = 0; dir < Tdim; dir++) {
-        drag_matrix_[dir].resize(nnodes_, nnodes_);
-        drag_matrix_[dir].setZero();
-      }
+      for (unsigned dir = 0; dir < Tdim; dir++)
+        drag_matrix_[dir].setZero(nnodes_, nnodes_);
 
       // Initialse Laplacian matrix (NxN)
-      laplacian_matrix_.resize(nnodes_, nnodes_);
-      laplacian_matrix_.setZero();
+      laplacian_matrix_.setZero(nnodes_, nnodes_);
 
       // Initialse poisson RHS matrix (Nx(N*Tdim))
-      poisson_right_matrix_twophase_.resize(2);
       for (unsigned phase = 0; phase < poisson_right_matrix_twophase_.size();
-           phase++) {
-        poisson_right_matrix_twophase_[phase].resize(nnodes_, nnodes_ * Tdim);
-        poisson_right_matrix_twophase_[phase].setZero();
-      }
+           phase++)
+        poisson_right_matrix_twophase_[phase].setZero(nnodes_, nnodes_ * Tdim);
 
       // Initialse correction RHS matrix (NxTdim)
-      correction_matrix_twophase_.resize(2);
       for (unsigned phase = 0; phase < correction_matrix_twophase_.size();
-           phase++) {
-        correction_matrix_twophase_[phase].resize(nnodes_, nnodes_ * Tdim);
-        correction_matrix_twophase_[phase].setZero();
-      }
+           phase++)
+        correction_matrix_twophase_[phase].setZero(nnodes_, nnodes_ * Tdim);
 
     } catch (std::exception& exception) {
-      console_->error("{} #{}: {}\n", __FILE__, __LINE__, exception.what());
+      console()->error("{} #{}: {}\n", __FILE__, __LINE__, exception.what());
       status = false;
     }
   }
@@ -101,13 +90,13 @@ bool mpm::Cell<Tdim>::initialise_element_matrix_twophase() {
 //! Compute local matrix for drag force coupling
 template <unsigned Tdim>
 void mpm::Cell<Tdim>::compute_local_drag_matrix(
-    const Eigen::VectorXd& shapefn, double pvolume,
+    const Eigen::Ref<const Eigen::VectorXd>& shapefn, double pvolume,
     const VectorDim& multiplier) noexcept {
 
   assert(drag_matrix_.size() == Tdim);
 
   // Lock the storage
-  std::lock_guard<std::mutex> guard(cell_mutex_);
+  std::lock_guard<mpm::SpinMutex> guard(cell_mutex_);
   // Compute local drag matrix
   for (unsigned dir = 0; dir < Tdim; dir++)
     drag_matrix_[dir] +=
@@ -117,22 +106,36 @@ void mpm::Cell<Tdim>::compute_local_drag_matrix(
 //! Compute local matrix of laplacian
 template <unsigned Tdim>
 void mpm::Cell<Tdim>::compute_local_laplacian(
-    const Eigen::MatrixXd& grad_shapefn, double pvolume,
+    const Eigen::Ref<const Eigen::MatrixXd>& grad_shapefn, double pvolume,
     double multiplier) noexcept {
 
-  std::lock_guard<std::mutex> guard(cell_mutex_);
-  laplacian_matrix_.noalias() +=
-      grad_shapefn * grad_shapefn.transpose() * multiplier * pvolume;
+  std::lock_guard<mpm::SpinMutex> guard(cell_mutex_);
+  // The rank-Tdim update G * G^T is symmetric: accumulate the lower
+  // triangle only and mirror, halving the flops of the full Eigen product
+  // on these small per-cell matrices
+  const double coeff = multiplier * pvolume;
+  for (unsigned i = 0; i < this->nnodes_; ++i) {
+    // Each inner iteration writes a distinct (i, j) / (j, i) pair, so the
+    // loop vectorizes safely on targets without hand-tuned kernels
+#pragma omp simd
+    for (unsigned j = 0; j <= i; ++j) {
+      const double value =
+          coeff * grad_shapefn.row(i).dot(grad_shapefn.row(j));
+      laplacian_matrix_(i, j) += value;
+      if (i != j) laplacian_matrix_(j, i) += value;
+    }
+  }
 }
 
 //! Compute local poisson RHS matrix
 //! Used in poisson equation RHS for Navier Stokes solver
 template <unsigned Tdim>
 void mpm::Cell<Tdim>::compute_local_poisson_right(
-    const Eigen::VectorXd& shapefn, const Eigen::MatrixXd& grad_shapefn,
-    double pvolume, double multiplier) noexcept {
+    const Eigen::Ref<const Eigen::VectorXd>& shapefn,
+    const Eigen::Ref<const Eigen::MatrixXd>& grad_shapefn, double pvolume,
+    double multiplier) noexcept {
 
-  std::lock_guard<std::mutex> guard(cell_mutex_);
+  std::lock_guard<mpm::SpinMutex> guard(cell_mutex_);
   for (unsigned i = 0; i < Tdim; i++) {
     poisson_right_matrix_.block(0, i * nnodes_, nnodes_, nnodes_).noalias() +=
         shapefn * grad_shapefn.col(i).transpose() * multiplier * pvolume;
@@ -143,14 +146,14 @@ void mpm::Cell<Tdim>::compute_local_poisson_right(
 //! Used in poisson equation RHS for TwoPhase solver
 template <unsigned Tdim>
 void mpm::Cell<Tdim>::compute_local_poisson_right_twophase(
-    unsigned phase, const Eigen::VectorXd& shapefn,
-    const Eigen::MatrixXd& grad_shapefn, double pvolume,
+    unsigned phase, const Eigen::Ref<const Eigen::VectorXd>& shapefn,
+    const Eigen::Ref<const Eigen::MatrixXd>& grad_shapefn, double pvolume,
     double multiplier) noexcept {
 
   assert(phase < poisson_right_matrix_twophase_.size() &&
          poisson_right_matrix_twophase_.size() == 2);
 
-  std::lock_guard<std::mutex> guard(cell_mutex_);
+  std::lock_guard<mpm::SpinMutex> guard(cell_mutex_);
   for (unsigned i = 0; i < Tdim; i++) {
     poisson_right_matrix_twophase_[phase]
         .block(0, i * nnodes_, nnodes_, nnodes_)
@@ -159,14 +162,36 @@ void mpm::Cell<Tdim>::compute_local_poisson_right_twophase(
   }
 }
 
+//! Compute local poisson RHS and correction matrices in a single pass
+//! Used in the semi-implicit Navier Stokes solver, where both matrices are
+//! accumulated from the same particle sweep
+template <unsigned Tdim>
+void mpm::Cell<Tdim>::compute_local_poisson_right_and_correction(
+    const Eigen::Ref<const Eigen::VectorXd>& shapefn,
+    const Eigen::Ref<const Eigen::MatrixXd>& grad_shapefn, double pvolume,
+    double multiplier) noexcept {
+
+  // Form the volume-weighted outer products once, outside the lock, so
+  // only the two accumulations below hold the spin mutex
+  Eigen::MatrixXd outer(nnodes_, nnodes_ * Tdim);
+  for (unsigned i = 0; i < Tdim; i++)
+    outer.block(0, i * nnodes_, nnodes_, nnodes_).noalias() =
+        shapefn * grad_shapefn.col(i).transpose() * pvolume;
+
+  std::lock_guard<mpm::SpinMutex> guard(cell_mutex_);
+  correction_matrix_ += outer;
+  poisson_right_matrix_ += multiplier * outer;
+}
+
 //! Compute local correction matrix
 //! Used to compute corrector of nodal velocity for Navier Stokes solver
 template <unsigned Tdim>
 void mpm::Cell<Tdim>::compute_local_correction_matrix(
-    const Eigen::VectorXd& shapefn, const Eigen::MatrixXd& grad_shapefn,
+    const Eigen::Ref<const Eigen::VectorXd>& shapefn,
+    const Eigen::Ref<const Eigen::MatrixXd>& grad_shapefn,
     double pvolume) noexcept {
 
-  std::lock_guard<std::mutex> guard(cell_mutex_);
+  std::lock_guard<mpm::SpinMutex> guard(cell_mutex_);
   for (unsigned i = 0; i < Tdim; i++) {
     correction_matrix_.block(0, i * nnodes_, nnodes_, nnodes_).noalias() +=
         shapefn * grad_shapefn.col(i).transpose() * pvolume;
@@ -177,14 +202,14 @@ void mpm::Cell<Tdim>::compute_local_correction_matrix(
 //! Used to compute corrector of nodal velocity for Two Phase solver
 template <unsigned Tdim>
 void mpm::Cell<Tdim>::compute_local_correction_matrix_twophase(
-    unsigned phase, const Eigen::VectorXd& shapefn,
-    const Eigen::MatrixXd& grad_shapefn, double pvolume,
+    unsigned phase, const Eigen::Ref<const Eigen::VectorXd>& shapefn,
+    const Eigen::Ref<const Eigen::MatrixXd>& grad_shapefn, double pvolume,
     double multiplier) noexcept {
 
   assert(phase < correction_matrix_twophase_.size() &&
          correction_matrix_twophase_.size() == 2);
 
-  std::lock_guard<std::mutex> guard(cell_mutex_);
+  std::lock_guard<mpm::SpinMutex> guard(cell_mutex_);
   for (unsigned i = 0; i < Tdim; i++) {
     correction_matrix_twophase_[phase]
         .block(0, i * nnodes_, nnodes_, nnodes_)
@@ -55,6 +55,13 @@ class Vector {
   template <class Tunaryfn>
   Tunaryfn for_each(Tunaryfn fn);
 
+  //! Sort elements in the vector
+  //! \tparam Tcomparefn A binary comparison function
+  template <class Tcomparefn>
+  void sort(Tcomparefn fn) {
+    std::sort(elements_.begin(), elements_.end(), fn);
+  }
+
  private:
   // Unordered map of index and pointer
   std::vector<std::shared_ptr<T>> elements_;
@@ -1,6 +1,8 @@
 #ifndef MPM_BSPLINE_HEX_ELEMENT_H_
 #define MPM_BSPLINE_HEX_ELEMENT_H_
 
+#include <array>
+
 #include "hexahedron_element.h"
 
 namespace mpm {
@@ -27,17 +29,6 @@ class HexahedronBSplineElement : public HexahedronElement<3, 8> {
     static_assert(Tdim == 3, "Invalid dimension for a BSpline element");
     static_assert((Tpolynomial == 2),
                   "Specified number of polynomial order is not defined");
-
-    if (Tpolynomial == 2)
-      BSplineKnotVector = {{-1.5, -0.5, 0.5, 1.5}, {0.0, 0.0, 0.0, 0.5},
-                           {-1.0, -0.5, 0.5, 1.5}, {-1.5, -0.5, 0.5, 1.0},
-                           {-0.5, 0.0, 0.0, 0.0},  {0.0, 0.0, 0.5, 1.5},
-                           {-1.5, -0.5, 0.0, 0.0}};
-
-    //! Logger
-    std::string logger = "hex_bspline::<" + std::to_string(Tdim) + ", P" +
-                         std::to_string(Tpolynomial) + ">";
-    console_ = std::make_unique<spdlog::logger>(logger, mpm::stdout_sink);
   }
 
   //! Evaluate shape functions at given local coordinates
@@ -132,29 +123,24 @@ class HexahedronBSplineElement : public HexahedronElement<3, 8> {
   };
 
  private:
-  //! Compute B-Spline Basis Function using the recursive De Boor's algorithm
-  //! for single direction
-  //! \param[in] point_coord point coordinate in one direction
-  //! \param[in] nodal_coord nodal coordinate in one direction
-  //! dimension
-  //! \param[in] node_type Node type associated with direction
-  //! \param[in] poly_order Polynomial degree
-  //! \param[in] index Index associated to local BSplineKnotVector
-  double kernel(double point_coord, double nodal_coord, unsigned node_type,
-                unsigned poly_order, unsigned index = 0) const;
+  //! Reciprocal knot-span widths of one node type, indexed [degree][index]
+  using InvKnotSpan =
+      std::array<std::array<double, 2 * Tpolynomial + 2>, Tpolynomial + 1>;
 
-  //! Compute B-Spline Basis Function Gradient using the recursive De Boor's
-  //! algorithm for single direction
-  //! \param[in] point_coord point coordinate in one direction
-  //! \param[in] nodal_coord nodal coordinate in one direction dimension
-  //! \param[in] node_type Node type associated with direction
-  //! \param[in] poly_order Polynomial degree
-  //! \param[in] index Index associated to local BSplineKnotVector
-  double gradient(double point_coord, double nodal_coord, unsigned node_type,
-                  unsigned poly_order, unsigned index = 0) const;
+  //! Largest possible connectivity: (Tpolynomial + 2) nodes per direction
+  static const unsigned kMaxConnectivity =
+      (Tpolynomial + 2) * (Tpolynomial + 2) * (Tpolynomial + 2);
+
+  //! Per-direction basis cache with a compile-time maximum size
+  //! \details The bounded capacity lets Eigen place the cache on the stack,
+  //! so the shape-function paths allocate nothing per call
+  using BasisCache = Eigen::Matrix<double, Eigen::Dynamic, Tdim,
+                                   Eigen::ColMajor, kMaxConnectivity, Tdim>;
 
-  //! Function that returns BSpline knot vector
-  //! The order of the vectors are:
+  //! BSpline knot vector per node type in reference spacing units
+  //! \details A constexpr table shared by all instances and threads from
+  //! read-only storage, instead of per-instance heap vectors. The order of
+  //! the rows is:
   //! Regular = 0,
   //! LowerBoundary = 1,
   //! LowerIntermediate = 2,
@@ -162,22 +148,135 @@ class HexahedronBSplineElement : public HexahedronElement<3, 8> {
   //! UpperBoundary = 4,
   //! LowerBoundaryVirtual = 5, (automatically defined)
   //! UpperBoundaryVirtual = 6 (automatically defined)
-  std::vector<double> knot(unsigned node_type) const {
-    return BSplineKnotVector[node_type];
+  static constexpr std::array<std::array<double, Tpolynomial + 2>, 7> kKnots{
+      {{{-1.5, -0.5, 0.5, 1.5}},
+       {{0.0, 0.0, 0.0, 0.5}},
+       {{-1.0, -0.5, 0.5, 1.5}},
+       {{-1.5, -0.5, 0.5, 1.0}},
+       {{-0.5, 0.0, 0.0, 0.0}},
+       {{0.0, 0.0, 0.5, 1.5}},
+       {{-1.5, -0.5, 0.0, 0.0}}}};
+
+  //! Sentinel for node types without a virtual-boundary correction
+  static constexpr uint8_t kNoSecondary{0xFF};
+  //! Secondary virtual-boundary knot type per node type
+  //! \details Replaces the duplicated switch statements in the basis loops:
+  //! LowerBoundary (1) adds the LowerBoundaryVirtual (5) contribution and
+  //! UpperBoundary (4) the UpperBoundaryVirtual (6) one
+  static constexpr std::array<uint8_t, 7> kSecondaryType{
+      {kNoSecondary, 5, kNoSecondary, kNoSecondary, 6, kNoSecondary,
+       kNoSecondary}};
+
+  //! Map local to physical coordinates, memoising the last evaluation
+  //! \details shapefn and dn_dx are invoked back to back with the same local
+  //! coordinate for every particle; a thread-local memo skips the repeated
+  //! 8-node interpolation on the second call. Each thread owns its slot, so
+  //! the shared element instance stays free of data races
+  //! \param[in] xi given local coordinates
+  //! \param[in] particle_size Particle size
+  //! \param[in] deformation_gradient Deformation gradient
+  //! \param[out] pcoord Physical coordinates of the evaluation point
+  //! \retval status true unless the local shape functions threw
+  bool physical_coordinates(const VectorDim& xi, VectorDim& particle_size,
+                            const MatrixDim& deformation_gradient,
+                            VectorDim& pcoord) const;
+
+  //! Evaluate the reference gradients and the jacobian in one basis pass
+  //! \details Shared by jacobian() and bmatrix() so each public entry point
+  //! costs exactly one B-spline basis evaluation. Element objects are shared
+  //! across cells and threads, so the bundle is returned to the caller
+  //! instead of being cached on the element
+  //! \param[in] xi given local coordinates
+  //! \param[in] nodal_coordinates Coordinates of nodes forming the cell
+  //! \param[in] particle_size Particle size
+  //! \param[in] deformation_gradient Deformation gradient
+  //! \param[out] grad_sf Gradient of shape functions
+  //! \retval jacobian Jacobian matrix
+  Eigen::Matrix<double, Tdim, Tdim> grad_shapefn_and_jacobian(
+      const VectorDim& xi, const Eigen::MatrixXd& nodal_coordinates,
+      VectorDim& particle_size, const MatrixDim& deformation_gradient,
+      Eigen::MatrixXd& grad_sf) const;
+
+  //! Tabulate B-Spline basis functions with the iterative Cox-de Boor
+  //! recurrence for a single direction
+  //! \details The triangular table is computed in-place in O(poly_order^2)
+  //! instead of the O(2^poly_order) naive recursion; after the sweep,
+  //! entry j holds the basis of degree target_degree at (index + j)
+  //! \param[in] point_coord point coordinate in one direction
+  //! \param[in] knot_coord Knot coordinates in one direction
+  //! \param[in] inv_span Reciprocal knot-span widths of the node type
+  //! \param[in] poly_order Polynomial degree
+  //! \param[in] target_degree Degree at which the sweep stops
+  //! \param[in] index Index associated to local BSplineKnotVector
+  std::array<double, Tpolynomial + 1> cox_de_boor(
+      double point_coord,
+      const std::array<double, 2 * Tpolynomial + 2>& knot_coord,
+      const InvKnotSpan& inv_span, unsigned poly_order, unsigned target_degree,
+      unsigned index) const;
+
+  //! Return the node type of a connectivity node in one direction
+  //! \param[in] n Local node index
+  //! \param[in] dim Direction
+  unsigned node_type(unsigned n, unsigned dim) const {
+    return (node_type_[n] >> (3 * dim)) & 7u;
   }
 
-  //! Logger
-  std::unique_ptr<spdlog::logger> console_;
+  //! Compute knot coordinates in one direction on the stack
+  //! \details Shifts the reference knot vector of the node type by the nodal
+  //! coordinate; a stack array avoids the per-call Eigen heap vectors the
+  //! basis evaluation used to construct
+  //! \param[in] nodal_coord nodal coordinate in one direction
+  //! \param[in] node_type Node type associated with direction
+  std::array<double, 2 * Tpolynomial + 2> knot_coordinates(
+      double nodal_coord, unsigned node_type) const {
+    const std::array<double, Tpolynomial + 2>& knot = kKnots[node_type];
+    std::array<double, 2 * Tpolynomial + 2> knot_coord{};
+    for (std::size_t k = 0; k < knot.size(); ++k)
+      knot_coord[k] = nodal_coord + spacing_length_ * knot[k];
+    return knot_coord;
+  }
+
+  //! Compute B-Spline Basis Function of degree Tpolynomial for a single
+  //! direction
+  //! \details The degree is the compile-time polynomial order, so the
+  //! Cox-de Boor sweep fully unrolls and constant-folds at the call site
+  //! \param[in] point_coord point coordinate in one direction
+  //! \param[in] nodal_coord nodal coordinate in one direction
+  //! dimension
+  //! \param[in] node_type Node type associated with direction
+  double kernel(double point_coord, double nodal_coord,
+                unsigned node_type) const;
+
+  //! Compute B-Spline Basis Function Gradient of degree Tpolynomial for a
+  //! single direction
+  //! \details The degree is the compile-time polynomial order, so the
+  //! Cox-de Boor sweep fully unrolls and constant-folds at the call site
+  //! \param[in] point_coord point coordinate in one direction
+  //! \param[in] nodal_coord nodal coordinate in one direction dimension
+  //! \param[in] node_type Node type associated with direction
+  double gradient(double point_coord, double nodal_coord,
+                  unsigned node_type) const;
+
+  //! Return the class logger shared by all elements of this instantiation
+  static spdlog::logger* console();
+
   //! Number of connectivity
   unsigned nconnectivity_{8};
   //! Spacing length
   double spacing_length_;
   //! Nodal coordinates vector (n_connectivity_ x Tdim)
+  //! \details Column-major storage keeps each direction contiguous
   Eigen::MatrixXd nodal_coordinates_;
-  //! Nodal type matrix (n_connectivity_ x Tdim)
-  std::vector<std::vector<unsigned>> node_type_;
-  //! BSpline knot vector for different node type
-  std::vector<std::vector<double>> BSplineKnotVector;
+  //! Nodal types packed into one word per node, 3 bits per direction
+  //! \details Types span 0..6, so Tdim of them fit a uint16_t: the whole
+  //! connectivity's types stay resident in a few cache lines and each
+  //! lookup is a shift and mask on one load
+  std::vector<uint16_t> node_type_;
+  //! Reciprocal knot-span widths per node type, indexed [type][degree][index]
+  //! \details An entry is 1 / (knot_coord[j + degree] - knot_coord[j]), with
+  //! zero stored for degenerate spans, so the basis recurrence needs no
+  //! division and no epsilon test at evaluation time
+  std::array<InvKnotSpan, 7> inv_knot_span_;
 };
 
 }  // namespace mpm
@@ -1,3 +1,27 @@
+//! Return the class logger shared by all elements of this instantiation
+template <unsigned Tdim, unsigned Tpolynomial>
+spdlog::logger* mpm::HexahedronBSplineElement<Tdim, Tpolynomial>::console() {
+  // A single logger per template instantiation; a per-element logger would
+  // add a heap allocation and a pointer chase on every error path
+  static const auto console = std::make_unique<spdlog::logger>(
+      "hex_bspline::<" + std::to_string(Tdim) + ", P" +
+          std::to_string(Tpolynomial) + ">",
+      mpm::stdout_sink);
+  return console.get();
+}
+
+//! Definition of the static knot table
+template <unsigned Tdim, unsigned Tpolynomial>
+constexpr std::array<std::array<double, Tpolynomial + 2>, 7>
+    mpm::HexahedronBSplineElement<Tdim, Tpolynomial>::kKnots;
+
+//! Definition of the static secondary-type lookup table
+template <unsigned Tdim, unsigned Tpolynomial>
+constexpr std::array<uint8_t, 7>
+    mpm::HexahedronBSplineElement<Tdim, Tpolynomial>::kSecondaryType;
+template <unsigned Tdim, unsigned Tpolynomial>
+constexpr uint8_t mpm::HexahedronBSplineElement<Tdim, Tpolynomial>::kNoSecondary;
+
 //! Assign nodal connectivity property for bspline elements
 template <unsigned Tdim, unsigned Tpolynomial>
 void mpm::HexahedronBSplineElement<Tdim, Tpolynomial>::
@@ -8,11 +32,69 @@ void mpm::HexahedronBSplineElement<Tdim, Tpolynomial>::
 
   this->nconnectivity_ = nodal_coordinates.rows();
   this->nodal_coordinates_ = nodal_coordinates;
-  this->node_type_ = nodal_properties;
+
+  //! Pack the nested node-type vectors into one word per node, 3 bits per
+  //! direction
+  this->node_type_.resize(this->nconnectivity_);
+  for (unsigned n = 0; n < this->nconnectivity_; ++n) {
+    uint16_t packed = 0;
+    for (unsigned i = 0; i < Tdim; ++i)
+      packed |= static_cast<uint16_t>(nodal_properties[n][i] & 7u) << (3 * i);
+    this->node_type_[n] = packed;
+  }
 
   //! Uniform spacing length in 3D
   this->spacing_length_ =
       std::abs(nodal_coordinates(1, 0) - nodal_coordinates(0, 0));
+
+  //! Precompute reciprocal knot-span widths for every node type and degree;
+  //! degenerate (repeated-knot) spans store zero so the basis recurrence
+  //! multiplies instead of dividing and testing against epsilon
+  for (unsigned t = 0; t < kKnots.size(); ++t) {
+    const std::array<double, Tpolynomial + 2>& knot = kKnots[t];
+    for (auto& span : inv_knot_span_[t]) span.fill(0.);
+    for (unsigned p = 1; p <= Tpolynomial; ++p)
+      for (unsigned j = 0; j + p < knot.size(); ++j) {
+        const double den = spacing_length_ * (knot[j + p] - knot[j]);
+        if (den >= std::numeric_limits<double>::epsilon())
+          inv_knot_span_[t][p][j] = 1. / den;
+      }
+  }
+}
+
+//! Map local to physical coordinates, memoising the last evaluation
+template <unsigned Tdim, unsigned Tpolynomial>
+bool mpm::HexahedronBSplineElement<Tdim, Tpolynomial>::physical_coordinates(
+    const VectorDim& xi, VectorDim& particle_size,
+    const MatrixDim& deformation_gradient, VectorDim& pcoord) const {
+  static thread_local const void* last_element = nullptr;
+  static thread_local VectorDim last_xi;
+  static thread_local VectorDim last_pcoord;
+  if (last_element == this && last_xi == xi) {
+    pcoord = last_pcoord;
+    return true;
+  }
+
+  //! The exception boundary covers only the local-to-real mapping; keeping
+  //! the node loops outside the try block lets the compiler vectorize them
+  try {
+    //! Convert local coordinates to real coordinates; a single matrix-vector
+    //! product over the contiguous coordinate columns replaces the per-node
+    //! scaled row adds and their strided Vector3d temporaries
+    auto local_shapefn =
+        this->shapefn_local(xi, particle_size, deformation_gradient);
+    pcoord.noalias() = nodal_coordinates_.topRows(local_shapefn.size())
+                           .transpose() *
+                       local_shapefn;
+  } catch (std::exception& exception) {
+    console()->error("{} #{}: {}\n", __FILE__, __LINE__, exception.what());
+    return false;
+  }
+
+  last_element = this;
+  last_xi = xi;
+  last_pcoord = pcoord;
+  return true;
 }
 
 //! Return shape functions of a Hexahedron BSpline Element at a given
@@ -32,41 +114,39 @@ inline Eigen::VectorXd
     return mpm::HexahedronElement<Tdim, 8>::shapefn(xi, particle_size,
                                                     deformation_gradient);
 
-  try {
-    //! Convert local coordinates to real coordinates
-    Eigen::Matrix<double, Tdim, 1> pcoord;
-    pcoord.setZero();
-    auto local_shapefn =
-        this->shapefn_local(xi, particle_size, deformation_gradient);
-    for (unsigned i = 0; i < local_shapefn.size(); ++i)
-      pcoord.noalias() +=
-          local_shapefn(i) * nodal_coordinates_.row(i).transpose();
+  //! Physical coordinates of the evaluation point, memoised per thread
+  Eigen::Matrix<double, Tdim, 1> pcoord;
+  if (!this->physical_coordinates(xi, particle_size, deformation_gradient,
+                                  pcoord))
+    return shapefn;
 
-    //! Compute shape function following a multiplicative rule
+  //! Tabulate the 1D basis per (node, direction); the direction loop is
+  //! outermost so the node loop streams through one contiguous
+  //! (column-major) coordinate column, letting the compiler vectorize
+  //! across nodes
+  BasisCache nvalues(this->nconnectivity_, Tdim);
+  for (unsigned i = 0; i < Tdim; ++i) {
+    const double pc = pcoord[i];
+    //! Loop over nodes: iterations are independent
+#pragma omp simd
     for (unsigned n = 0; n < this->nconnectivity_; ++n) {
-      //! Loop over dimension
-      for (unsigned i = 0; i < Tdim; ++i) {
-        double N = this->kernel(pcoord[i], nodal_coordinates_.row(n)[i],
-                                this->node_type_[n][i], Tpolynomial);
-        switch (this->node_type_[n][i]) {
-          case 1:
-            N += this->kernel(pcoord[i], nodal_coordinates_.row(n)[i], 5,
-                              Tpolynomial);
-            break;
-          case 4:
-            N += this->kernel(pcoord[i], nodal_coordinates_.row(n)[i], 6,
-                              Tpolynomial);
-            break;
-        }
-
-        shapefn[n] = shapefn[n] * N;
-      }
+      const double ncoord = nodal_coordinates_(n, i);
+      const unsigned ntype = this->node_type(n, i);
+      double N = this->kernel(pc, ncoord, ntype);
+      //! Boundary node types add their virtual-knot contribution, selected
+      //! by table lookup instead of a switch
+      const uint8_t secondary = kSecondaryType[ntype];
+      if (secondary != kNoSecondary) N += this->kernel(pc, ncoord, secondary);
+
+      nvalues(n, i) = N;
     }
-
-  } catch (std::exception& exception) {
-    console_->error("{} #{}: {}\n", __FILE__, __LINE__, exception.what());
-    return shapefn;
   }
+
+  //! The multiplicative rule reduces to elementwise products of contiguous
+  //! basis columns, which Eigen maps onto packed SIMD multiplies
+  shapefn = nvalues.col(0);
+  for (unsigned i = 1; i < Tdim; ++i)
+    shapefn.array() *= nvalues.col(i).array();
   return shapefn;
 }
 
@@ -86,57 +166,46 @@ inline Eigen::MatrixXd
     return mpm::HexahedronElement<Tdim, 8>::grad_shapefn(xi, particle_size,
                                                          deformation_gradient);
 
-  try {
-    //! Convert local coordinates to real coordinates
-    Eigen::Matrix<double, Tdim, 1> pcoord;
-    pcoord.setZero();
-    auto local_shapefn =
-        this->shapefn_local(xi, particle_size, deformation_gradient);
-    for (unsigned i = 0; i < local_shapefn.size(); ++i)
-      pcoord.noalias() +=
-          local_shapefn(i) * nodal_coordinates_.row(i).transpose();
-
-    //! Compute the shape function gradient following a multiplicative rule
-    for (unsigned n = 0; n < this->nconnectivity_; ++n)
-      //! Loop over dimension
-      for (unsigned i = 0; i < Tdim; ++i) {
-        double dN_dx = this->gradient(pcoord[i], nodal_coordinates_.row(n)[i],
-                                      (this->node_type_[n])[i], Tpolynomial);
-        switch (this->node_type_[n][i]) {
-          case 1:
-            dN_dx += this->gradient(pcoord[i], nodal_coordinates_.row(n)[i], 5,
-                                    Tpolynomial);
-            break;
-          case 4:
-            dN_dx += this->gradient(pcoord[i], nodal_coordinates_.row(n)[i], 6,
-                                    Tpolynomial);
-            break;
-        }
-
-        for (unsigned j = 0; j < Tdim; ++j) {
-          if (j != i) {
-            double N = this->kernel(pcoord[j], nodal_coordinates_.row(n)[j],
-                                    this->node_type_[n][j], Tpolynomial);
-            switch (this->node_type_[n][j]) {
-              case 1:
-                N += this->kernel(pcoord[j], nodal_coordinates_.row(n)[j], 5,
-                                  Tpolynomial);
-                break;
-              case 4:
-                N += this->kernel(pcoord[j], nodal_coordinates_.row(n)[j], 6,
-                                  Tpolynomial);
-                break;
-            }
-            dN_dx = dN_dx * N;
-          }
-        }
-
-        grad_shapefn(n, i) = dN_dx;
+  //! Physical coordinates of the evaluation point, memoised per thread
+  Eigen::Matrix<double, Tdim, 1> pcoord;
+  if (!this->physical_coordinates(xi, particle_size, deformation_gradient,
+                                  pcoord))
+    return grad_shapefn;
+
+  //! Cache the 1D basis and its derivative per (node, direction): the
+  //! multiplicative rule below reads each basis value (Tdim - 1) times,
+  //! and recomputing it per read repeats the whole Cox-de Boor tabulation
+  BasisCache nvalues(this->nconnectivity_, Tdim);
+  BasisCache dnvalues(this->nconnectivity_, Tdim);
+  //! The direction loop is outermost so the node loop streams through one
+  //! contiguous coordinate column and writes contiguous value columns
+  for (unsigned i = 0; i < Tdim; ++i) {
+    const double pc = pcoord[i];
+    //! Loop over nodes: iterations are independent
+#pragma omp simd
+    for (unsigned n = 0; n < this->nconnectivity_; ++n) {
+      const double ncoord = nodal_coordinates_(n, i);
+      const unsigned ntype = this->node_type(n, i);
+      double N = this->kernel(pc, ncoord, ntype);
+      double dN_dx = this->gradient(pc, ncoord, ntype);
+      //! Boundary node types add their virtual-knot contribution, selected
+      //! by table lookup instead of a switch
+      const uint8_t secondary = kSecondaryType[ntype];
+      if (secondary != kNoSecondary) {
+        N += this->kernel(pc, ncoord, secondary);
+        dN_dx += this->gradient(pc, ncoord, secondary);
       }
+      nvalues(n, i) = N;
+      dnvalues(n, i) = dN_dx;
+    }
+  }
 
-  } catch (std::exception& exception) {
-    console_->error("{} #{}: {}\n", __FILE__, __LINE__, exception.what());
-    return grad_shapefn;
+  //! The multiplicative rule reduces to elementwise products of contiguous
+  //! basis columns, which Eigen maps onto packed SIMD multiplies
+  for (unsigned i = 0; i < Tdim; ++i) {
+    grad_shapefn.col(i) = dnvalues.col(i);
+    for (unsigned j = 0; j < Tdim; ++j)
+      if (j != i) grad_shapefn.col(i).array() *= nvalues.col(j).array();
   }
   return grad_shapefn;
 }
@@ -154,6 +223,24 @@ inline Eigen::VectorXd
                                                   deformation_gradient);
 }
 
+//! Evaluate the reference gradients and the jacobian in one basis pass
+template <unsigned Tdim, unsigned Tpolynomial>
+inline Eigen::Matrix<double, Tdim, Tdim>
+    mpm::HexahedronBSplineElement<Tdim, Tpolynomial>::grad_shapefn_and_jacobian(
+        const VectorDim& xi, const Eigen::MatrixXd& nodal_coordinates,
+        VectorDim& particle_size, const MatrixDim& deformation_gradient,
+        Eigen::MatrixXd& grad_sf) const {
+  // Get gradient shape functions
+  grad_sf = this->grad_shapefn(xi, particle_size, deformation_gradient);
+  // Dimension mismatches are programming errors, so the check is debug-only
+  // and the hot path carries no exception machinery
+  assert(grad_sf.rows() == nodal_coordinates.rows() &&
+         xi.size() == nodal_coordinates.cols());
+
+  // Jacobian
+  return (grad_sf.transpose() * nodal_coordinates);
+}
+
 //! Compute Jacobian
 template <unsigned Tdim, unsigned Tpolynomial>
 inline Eigen::Matrix<double, Tdim, Tdim>
@@ -162,23 +249,9 @@ inline Eigen::Matrix<double, Tdim, Tdim>
         const Eigen::MatrixXd& nodal_coordinates,
         Eigen::Matrix<double, 3, 1>& particle_size,
         const Eigen::Matrix<double, 3, 3>& deformation_gradient) const {
-  // Get gradient shape functions
-  const Eigen::MatrixXd grad_shapefn =
-      this->grad_shapefn(xi, particle_size, deformation_gradient);
-  try {
-    // Check if dimensions are correct
-    if ((grad_shapefn.rows() != nodal_coordinates.rows()) ||
-        (xi.size() != nodal_coordinates.cols()))
-      throw std::runtime_error(
-          "Jacobian calculation: Incorrect dimension of xi and "
-          "nodal_coordinates");
-  } catch (std::exception& exception) {
-    console_->error("{} #{}: {}\n", __FILE__, __LINE__, exception.what());
-    return Eigen::Matrix<double, Tdim, Tdim>::Zero();
-  }
-
-  // Jacobian
-  return (grad_shapefn.transpose() * nodal_coordinates);
+  Eigen::MatrixXd grad_sf;
+  return this->grad_shapefn_and_jacobian(xi, nodal_coordinates, particle_size,
+                                         deformation_gradient, grad_sf);
 }
 
 //! Compute dn_dx
@@ -208,116 +281,106 @@ inline std::vector<Eigen::MatrixXd>
     mpm::HexahedronBSplineElement<Tdim, Tpolynomial>::bmatrix(
         const VectorDim& xi, const Eigen::MatrixXd& nodal_coordinates,
         VectorDim& particle_size, const MatrixDim& deformation_gradient) const {
-  // Get gradient shape functions
-  Eigen::MatrixXd grad_sf =
-      this->grad_shapefn(xi, particle_size, deformation_gradient);
-
   // B-Matrix
   std::vector<Eigen::MatrixXd> bmatrix;
   bmatrix.reserve(this->nconnectivity_);
 
-  try {
-    // Check if matrices dimensions are correct
-    if ((grad_sf.rows() != nodal_coordinates.rows()) ||
-        (xi.rows() != nodal_coordinates.cols()))
-      throw std::runtime_error(
-          "BMatrix - Jacobian calculation: Incorrect dimension of xi and "
-          "nodal_coordinates");
-  } catch (std::exception& exception) {
-    console_->error("{} #{}: {}\n", __FILE__, __LINE__, exception.what());
-    return bmatrix;
-  }
+  // Dimension mismatches are programming errors, so the check is debug-only
+  // and the hot path carries no exception machinery
+  assert(this->nconnectivity_ == nodal_coordinates.rows() &&
+         xi.rows() == nodal_coordinates.cols());
 
-  // Jacobian dx_i/dxi_j
-  Eigen::Matrix<double, Tdim, Tdim> jacobian =
-      (grad_sf.transpose() * nodal_coordinates);
+  // Reference gradients and jacobian dx_i/dxi_j from one basis evaluation
+  Eigen::MatrixXd grad_sf;
+  const Eigen::Matrix<double, Tdim, Tdim> jacobian =
+      this->grad_shapefn_and_jacobian(xi, nodal_coordinates, particle_size,
+                                      deformation_gradient, grad_sf);
 
   // Gradient shapefn of the cell
   // dN/dx = [J]^-1 * dN/dxi
   Eigen::MatrixXd grad_shapefn = grad_sf * (jacobian.inverse()).transpose();
 
+  // The zero pattern is identical for every node, so a single
+  // zero-initialised template is reused and only the nine nonzero entries
+  // are rewritten per node before being copied into the output
+  Eigen::Matrix<double, 6, Tdim> bi = Eigen::Matrix<double, 6, Tdim>::Zero();
   for (unsigned i = 0; i < this->nconnectivity_; ++i) {
     // clang-format off
-    Eigen::Matrix<double, 6, Tdim> bi;
-    bi(0, 0) = grad_shapefn(i, 0); bi(0, 1) = 0.;                 bi(0, 2) = 0.;
-    bi(1, 0) = 0.;                 bi(1, 1) = grad_shapefn(i, 1); bi(1, 2) = 0.;
-    bi(2, 0) = 0.;                 bi(2, 1) = 0.;                 bi(2, 2) = grad_shapefn(i, 2);
-    bi(3, 0) = grad_shapefn(i, 1); bi(3, 1) = grad_shapefn(i, 0); bi(3, 2) = 0.;
-    bi(4, 0) = 0.;                 bi(4, 1) = grad_shapefn(i, 2); bi(4, 2) = grad_shapefn(i, 1);
-    bi(5, 0) = grad_shapefn(i, 2); bi(5, 1) = 0.;                 bi(5, 2) = grad_shapefn(i, 0);
+    bi(0, 0) = grad_shapefn(i, 0);
+    bi(1, 1) = grad_shapefn(i, 1);
+    bi(2, 2) = grad_shapefn(i, 2);
+    bi(3, 0) = grad_shapefn(i, 1); bi(3, 1) = grad_shapefn(i, 0);
+    bi(4, 1) = grad_shapefn(i, 2); bi(4, 2) = grad_shapefn(i, 1);
+    bi(5, 0) = grad_shapefn(i, 2); bi(5, 2) = grad_shapefn(i, 0);
     // clang-format on
     bmatrix.push_back(bi);
   }
   return bmatrix;
 }
 
-//! Compute B-Spline Basis Function using the recursive De Boor's algorithm
-//! for single direction
+//! Tabulate B-Spline basis functions with the iterative Cox-de Boor
+//! recurrence for a single direction
 template <unsigned Tdim, unsigned Tpolynomial>
-double mpm::HexahedronBSplineElement<Tdim, Tpolynomial>::kernel(
-    double point_coord, double nodal_coord, unsigned node_type,
-    unsigned poly_order, unsigned index) const {
-  double value = 0.0;
-  //! Compute knot coordinate
-  Eigen::VectorXd knot_vector = Eigen::Map<Eigen::VectorXd, Eigen::Unaligned>(
-      (this->knot(node_type)).data(), (this->knot(node_type)).size());
-  const Eigen::VectorXd one =
-      Eigen::VectorXd::Constant(knot_vector.size(), 1.0);
-  const Eigen::VectorXd knot_coord =
-      nodal_coord * one + spacing_length_ * knot_vector;
-
-  if (poly_order == 0) {
-    if (point_coord >= knot_coord[index] &&
-        point_coord < knot_coord[index + 1]) {
-      value = 1.0;
-    } else {
-      value = 0.0;
+std::array<double, Tpolynomial + 1>
+    mpm::HexahedronBSplineElement<Tdim, Tpolynomial>::cox_de_boor(
+        double point_coord,
+        const std::array<double, 2 * Tpolynomial + 2>& knot_coord,
+        const InvKnotSpan& inv_span, unsigned poly_order,
+        unsigned target_degree, unsigned index) const {
+  //! Degree-0 indicator functions of the knot spans covering the basis
+  std::array<double, Tpolynomial + 1> basis{};
+  for (unsigned j = 0; j <= poly_order; ++j)
+    basis[j] = (point_coord >= knot_coord[index + j] &&
+                point_coord < knot_coord[index + j + 1])
+                   ? 1.0
+                   : 0.0;
+
+  //! Each sweep raises the degree by one, overwriting the table in place;
+  //! the naive double recursion recomputes these entries exponentially often.
+  //! Degenerate spans carry a zero reciprocal, so no branch is needed
+  for (unsigned p = 1; p <= target_degree; ++p) {
+    for (unsigned j = 0; j + p <= poly_order; ++j) {
+      const double a =
+          (point_coord - knot_coord[index + j]) * inv_span[p][index + j];
+      const double b = (knot_coord[index + j + p + 1] - point_coord) *
+                       inv_span[p][index + j + 1];
+      basis[j] = a * basis[j] + b * basis[j + 1];
     }
-  } else {
-    const double den_a = (knot_coord[index + poly_order] - knot_coord[index]);
-    double a = (point_coord - knot_coord(index)) / den_a;
-    if (den_a < std::numeric_limits<double>::epsilon()) a = 0;
-
-    const double den_b =
-        (knot_coord[index + poly_order + 1] - knot_coord[index + 1]);
-    double b = (knot_coord[index + poly_order + 1] - point_coord) / den_b;
-    if (den_b < std::numeric_limits<double>::epsilon()) b = 0;
-
-    value = a * this->kernel(point_coord, nodal_coord, node_type,
-                             poly_order - 1, index) +
-            b * this->kernel(point_coord, nodal_coord, node_type,
-                             poly_order - 1, index + 1);
   }
-  return value;
+  return basis;
+}
+
+//! Compute B-Spline Basis Function of degree Tpolynomial for a single
+//! direction
+template <unsigned Tdim, unsigned Tpolynomial>
+inline double mpm::HexahedronBSplineElement<Tdim, Tpolynomial>::kernel(
+    double point_coord, double nodal_coord, unsigned node_type) const {
+  //! Compute knot coordinate on the stack
+  const auto knot_coord = this->knot_coordinates(nodal_coord, node_type);
+
+  //! The degree and index are compile-time constants here, so the sweep in
+  //! cox_de_boor unrolls to straight-line arithmetic
+  return this->cox_de_boor(point_coord, knot_coord, inv_knot_span_[node_type],
+                           Tpolynomial, Tpolynomial, 0)[0];
 }
 
-//! Compute B-Spline Basis Function Gradient using the recursive De Boor's
-//! algorithm for single direction
+//! Compute B-Spline Basis Function Gradient of degree Tpolynomial for a
+//! single direction
 template <unsigned Tdim, unsigned Tpolynomial>
-double mpm::HexahedronBSplineElement<Tdim, Tpolynomial>::gradient(
-    double point_coord, double nodal_coord, unsigned node_type,
-    unsigned poly_order, unsigned index) const {
-  double value = 0;
-  Eigen::VectorXd knot_vector = Eigen::Map<Eigen::VectorXd, Eigen::Unaligned>(
-      (this->knot(node_type)).data(), (this->knot(node_type)).size());
-  const Eigen::VectorXd one =
-      Eigen::VectorXd::Constant(knot_vector.size(), 1.0);
-  const Eigen::VectorXd knot_coord =
-      nodal_coord * one + spacing_length_ * knot_vector;
-
-  const double den_a = (knot_coord[index + poly_order] - knot_coord[index]);
-  double a = poly_order / den_a;
-  if (den_a < std::numeric_limits<double>::epsilon()) a = 0;
-
-  const double den_b =
-      (knot_coord[index + poly_order + 1] - knot_coord[index + 1]);
-  double b = poly_order / den_b;
-  if (den_b < std::numeric_limits<double>::epsilon()) b = 0;
-
-  value = a * this->kernel(point_coord, nodal_coord, node_type, poly_order - 1,
-                           index) -
-          b * this->kernel(point_coord, nodal_coord, node_type, poly_order - 1,
-                           index + 1);
-
-  return value;
+inline double mpm::HexahedronBSplineElement<Tdim, Tpolynomial>::gradient(
+    double point_coord, double nodal_coord, unsigned node_type) const {
+  //! Compute knot coordinate on the stack
+  const auto knot_coord = this->knot_coordinates(nodal_coord, node_type);
+
+  //! The precomputed reciprocals are zero for degenerate spans, replacing
+  //! the division and epsilon test of the original recursion
+  const InvKnotSpan& inv_span = inv_knot_span_[node_type];
+  const double a = Tpolynomial * inv_span[Tpolynomial][0];
+  const double b = Tpolynomial * inv_span[Tpolynomial][1];
+
+  //! Both degree-(p-1) basis values come from one shared tabulation, which
+  //! unrolls completely for the compile-time degree
+  const auto basis = this->cox_de_boor(point_coord, knot_coord, inv_span,
+                                       Tpolynomial, Tpolynomial - 1, 0);
+  return a * basis[0] - b * basis[1];
 }
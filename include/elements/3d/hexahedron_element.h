@@ -2,6 +2,7 @@
 #define MPM_HEXAHEDRON_ELEMENT_H_
 
 #include "element.h"
+#include "hexahedron_quadrature.h"
 #include "logger.h"
 
 //! MPM namespace
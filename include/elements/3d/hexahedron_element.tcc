@@ -77,19 +77,22 @@ inline Eigen::MatrixXd mpm::HexahedronElement<3, 8>::grad_shapefn(
 template <>
 inline Eigen::MatrixXd mpm::HexahedronElement<3, 8>::unit_cell_coordinates()
     const {
-  // Coordinates of a unit cell
-  Eigen::Matrix<double, 8, 3> unit_cell;
-  // clang-format off
-  unit_cell << -1., -1., -1.,
-                1., -1., -1.,
-                1.,  1., -1.,
-               -1.,  1., -1.,
-               -1., -1.,  1.,
-                1., -1.,  1.,
-                1.,  1.,  1.,
+  // Coordinates of a unit cell, tabulated once
+  static const Eigen::Matrix<double, 8, 3> unit_cell = [] {
+    Eigen::Matrix<double, 8, 3> coords;
+    // clang-format off
+    coords << -1., -1., -1.,
+               1., -1., -1.,
+               1.,  1., -1.,
+              -1.,  1., -1.,
+              -1., -1.,  1.,
+               1., -1.,  1.,
+               1.,  1.,  1.,
     // cppcheck-suppress *
-               -1.,  1.,  1.;
-  // clang-format on
+              -1.,  1.,  1.;
+    // clang-format on
+    return coords;
+  }();
   return unit_cell;
 }
 
@@ -162,92 +165,80 @@ inline Eigen::MatrixXd mpm::HexahedronElement<3, 20>::grad_shapefn(
     const Eigen::Matrix<double, 3, 3>& deformation_gradient) const {
   Eigen::Matrix<double, 20, 3> grad_shapefn;
 
-  grad_shapefn(0, 0) =
-      0.125 * (2 * xi(0) + xi(1) + xi(2) + 1) * (1 - xi(1)) * (1 - xi(2));
-  grad_shapefn(1, 0) =
-      -0.125 * (-2 * xi(0) + xi(1) + xi(2) + 1) * (1 - xi(1)) * (1 - xi(2));
-  grad_shapefn(2, 0) =
-      -0.125 * (-2 * xi(0) - xi(1) + xi(2) + 1) * (1 + xi(1)) * (1 - xi(2));
-  grad_shapefn(3, 0) =
-      0.125 * (2 * xi(0) - xi(1) + xi(2) + 1) * (1 + xi(1)) * (1 - xi(2));
-  grad_shapefn(4, 0) =
-      0.125 * (2 * xi(0) + xi(1) - xi(2) + 1) * (1 - xi(1)) * (1 + xi(2));
-  grad_shapefn(5, 0) =
-      -0.125 * (-2 * xi(0) + xi(1) - xi(2) + 1) * (1 - xi(1)) * (1 + xi(2));
-  grad_shapefn(6, 0) =
-      -0.125 * (-2 * xi(0) - xi(1) - xi(2) + 1) * (1 + xi(1)) * (1 + xi(2));
-  grad_shapefn(7, 0) =
-      0.125 * (2 * xi(0) - xi(1) - xi(2) + 1) * (1 + xi(1)) * (1 + xi(2));
-  grad_shapefn(8, 0) = -0.5 * xi(0) * (1 - xi(1)) * (1 - xi(2));
-  grad_shapefn(9, 0) = -0.25 * (1 - xi(1) * xi(1)) * (1 - xi(2));
-  grad_shapefn(10, 0) = -0.25 * (1 - xi(2) * xi(2)) * (1 - xi(1));
-  grad_shapefn(11, 0) = 0.25 * (1 - xi(1) * xi(1)) * (1 - xi(2));
-  grad_shapefn(12, 0) = 0.25 * (1 - xi(2) * xi(2)) * (1 - xi(1));
-  grad_shapefn(13, 0) = -0.5 * xi(0) * (1 + xi(1)) * (1 - xi(2));
-  grad_shapefn(14, 0) = 0.25 * (1 - xi(2) * xi(2)) * (1 + xi(1));
-  grad_shapefn(15, 0) = -0.25 * (1 - xi(2) * xi(2)) * (1 + xi(1));
-  grad_shapefn(16, 0) = -0.5 * xi(0) * (1 - xi(1)) * (1 + xi(2));
-  grad_shapefn(18, 0) = 0.25 * (1 - xi(1) * xi(1)) * (1 + xi(2));
-  grad_shapefn(19, 0) = -0.5 * xi(0) * (1 + xi(1)) * (1 + xi(2));
-  grad_shapefn(17, 0) = -0.25 * (1 - xi(1) * xi(1)) * (1 + xi(2));
-
-  grad_shapefn(0, 1) =
-      0.125 * (xi(0) + 2 * xi(1) + xi(2) + 1) * (1 - xi(0)) * (1 - xi(2));
-  grad_shapefn(1, 1) =
-      0.125 * (-xi(0) + 2 * xi(1) + xi(2) + 1) * (1 + xi(0)) * (1 - xi(2));
-  grad_shapefn(2, 1) =
-      -0.125 * (-xi(0) - 2 * xi(1) + xi(2) + 1) * (1 + xi(0)) * (1 - xi(2));
-  grad_shapefn(3, 1) =
-      -0.125 * (xi(0) - 2 * xi(1) + xi(2) + 1) * (1 - xi(1)) * (1 - xi(2));
-  grad_shapefn(4, 1) =
-      0.125 * (xi(0) + 2 * xi(1) - xi(2) + 1) * (1 - xi(0)) * (1 + xi(2));
-  grad_shapefn(5, 1) =
-      0.125 * (-xi(0) + 2 * xi(1) - xi(2) + 1) * (1 + xi(0)) * (1 + xi(2));
-  grad_shapefn(6, 1) =
-      -0.125 * (-xi(0) - 2 * xi(1) - xi(2) + 1) * (1 + xi(0)) * (1 + xi(2));
-  grad_shapefn(7, 1) =
-      -0.125 * (xi(0) - 2 * xi(1) - xi(2) + 1) * (1 - xi(1)) * (1 + xi(2));
-  grad_shapefn(8, 1) = -0.25 * (1 - xi(0) * xi(0)) * (1 - xi(2));
-  grad_shapefn(9, 1) = -0.5 * xi(1) * (1 - xi(0)) * (1 - xi(2));
-  grad_shapefn(10, 1) = -0.25 * (1 - xi(2) * xi(2)) * (1 - xi(0));
-  grad_shapefn(11, 1) = -0.5 * xi(1) * (1 + xi(0)) * (1 - xi(2));
-  grad_shapefn(12, 1) = -0.25 * (1 - xi(2) * xi(2)) * (1 + xi(0));
-  grad_shapefn(13, 1) = 0.25 * (1 - xi(0) * xi(0)) * (1 - xi(2));
-  grad_shapefn(14, 1) = 0.25 * (1 - xi(2) * xi(2)) * (1 + xi(0));
-  grad_shapefn(15, 1) = 0.25 * (1 - xi(2) * xi(2)) * (1 - xi(0));
-  grad_shapefn(16, 1) = -0.25 * (1 - xi(0) * xi(0)) * (1 + xi(2));
-  grad_shapefn(18, 1) = -0.5 * xi(1) * (1 + xi(0)) * (1 + xi(2));
-  grad_shapefn(19, 1) = 0.25 * (1 - xi(0) * xi(0)) * (1 + xi(2));
-  grad_shapefn(17, 1) = -0.5 * xi(1) * (1 - xi(0)) * (1 + xi(2));
-
-  grad_shapefn(0, 2) =
-      0.125 * (xi(0) + xi(1) + 2 * xi(2) + 1) * (1 - xi(0)) * (1 - xi(1));
-  grad_shapefn(1, 2) =
-      0.125 * (-xi(0) + xi(1) + 2 * xi(2) + 1) * (1 + xi(0)) * (1 - xi(1));
-  grad_shapefn(2, 2) =
-      0.125 * (-xi(0) - xi(1) + 2 * xi(2) + 1) * (1 + xi(0)) * (1 + xi(1));
-  grad_shapefn(3, 2) =
-      0.125 * (xi(0) - xi(1) + 2 * xi(2) + 1) * (1 - xi(1)) * (1 + xi(1));
-  grad_shapefn(4, 2) =
-      -0.125 * (xi(0) + xi(1) - 2 * xi(2) + 1) * (1 - xi(0)) * (1 - xi(1));
-  grad_shapefn(5, 2) =
-      -0.125 * (-xi(0) + xi(1) - 2 * xi(2) + 1) * (1 + xi(0)) * (1 - xi(1));
-  grad_shapefn(6, 2) =
-      -0.125 * (-xi(0) - xi(1) - 2 * xi(2) + 1) * (1 + xi(0)) * (1 + xi(1));
-  grad_shapefn(7, 2) =
-      -0.125 * (xi(0) - xi(1) - 2 * xi(2) + 1) * (1 - xi(1)) * (1 + xi(1));
-  grad_shapefn(8, 2) = -0.25 * (1 - xi(0) * xi(0)) * (1 - xi(1));
-  grad_shapefn(9, 2) = -0.25 * (1 - xi(1) * xi(1)) * (1 - xi(0));
-  grad_shapefn(10, 2) = -0.5 * xi(2) * (1 - xi(0)) * (1 - xi(1));
-  grad_shapefn(11, 2) = -0.25 * (1 - xi(1) * xi(1)) * (1 + xi(0));
-  grad_shapefn(12, 2) = -0.5 * xi(2) * (1 + xi(0)) * (1 - xi(1));
-  grad_shapefn(13, 2) = -0.25 * (1 - xi(0) * xi(0)) * (1 + xi(1));
-  grad_shapefn(14, 2) = -0.5 * xi(2) * (1 + xi(0)) * (1 + xi(1));
-  grad_shapefn(15, 2) = -0.5 * xi(2) * (1 - xi(0)) * (1 + xi(1));
-  grad_shapefn(16, 2) = 0.25 * (1 - xi(0) * xi(0)) * (1 - xi(1));
-  grad_shapefn(18, 2) = 0.25 * (1 - xi(1) * xi(1)) * (1 + xi(0));
-  grad_shapefn(19, 2) = 0.25 * (1 - xi(0) * xi(0)) * (1 + xi(1));
-  grad_shapefn(17, 2) = 0.25 * (1 - xi(1) * xi(1)) * (1 - xi(0));
+  // Hoist the shared factors once: the compiler cannot eliminate the common
+  // subexpressions across the row assignments through Eigen's operator()
+  const double xm0 = 1. - xi(0);
+  const double xp0 = 1. + xi(0);
+  const double xm1 = 1. - xi(1);
+  const double xp1 = 1. + xi(1);
+  const double xm2 = 1. - xi(2);
+  const double xp2 = 1. + xi(2);
+  const double x0sq = 1. - xi(0) * xi(0);
+  const double x1sq = 1. - xi(1) * xi(1);
+  const double x2sq = 1. - xi(2) * xi(2);
+
+  grad_shapefn(0, 0) = 0.125 * (2 * xi(0) + xi(1) + xi(2) + 1) * xm1 * xm2;
+  grad_shapefn(1, 0) = -0.125 * (-2 * xi(0) + xi(1) + xi(2) + 1) * xm1 * xm2;
+  grad_shapefn(2, 0) = -0.125 * (-2 * xi(0) - xi(1) + xi(2) + 1) * xp1 * xm2;
+  grad_shapefn(3, 0) = 0.125 * (2 * xi(0) - xi(1) + xi(2) + 1) * xp1 * xm2;
+  grad_shapefn(4, 0) = 0.125 * (2 * xi(0) + xi(1) - xi(2) + 1) * xm1 * xp2;
+  grad_shapefn(5, 0) = -0.125 * (-2 * xi(0) + xi(1) - xi(2) + 1) * xm1 * xp2;
+  grad_shapefn(6, 0) = -0.125 * (-2 * xi(0) - xi(1) - xi(2) + 1) * xp1 * xp2;
+  grad_shapefn(7, 0) = 0.125 * (2 * xi(0) - xi(1) - xi(2) + 1) * xp1 * xp2;
+  grad_shapefn(8, 0) = -0.5 * xi(0) * xm1 * xm2;
+  grad_shapefn(9, 0) = -0.25 * x1sq * xm2;
+  grad_shapefn(10, 0) = -0.25 * x2sq * xm1;
+  grad_shapefn(11, 0) = 0.25 * x1sq * xm2;
+  grad_shapefn(12, 0) = 0.25 * x2sq * xm1;
+  grad_shapefn(13, 0) = -0.5 * xi(0) * xp1 * xm2;
+  grad_shapefn(14, 0) = 0.25 * x2sq * xp1;
+  grad_shapefn(15, 0) = -0.25 * x2sq * xp1;
+  grad_shapefn(16, 0) = -0.5 * xi(0) * xm1 * xp2;
+  grad_shapefn(18, 0) = 0.25 * x1sq * xp2;
+  grad_shapefn(19, 0) = -0.5 * xi(0) * xp1 * xp2;
+  grad_shapefn(17, 0) = -0.25 * x1sq * xp2;
+
+  grad_shapefn(0, 1) = 0.125 * (xi(0) + 2 * xi(1) + xi(2) + 1) * xm0 * xm2;
+  grad_shapefn(1, 1) = 0.125 * (-xi(0) + 2 * xi(1) + xi(2) + 1) * xp0 * xm2;
+  grad_shapefn(2, 1) = -0.125 * (-xi(0) - 2 * xi(1) + xi(2) + 1) * xp0 * xm2;
+  grad_shapefn(3, 1) = -0.125 * (xi(0) - 2 * xi(1) + xi(2) + 1) * xm0 * xm2;
+  grad_shapefn(4, 1) = 0.125 * (xi(0) + 2 * xi(1) - xi(2) + 1) * xm0 * xp2;
+  grad_shapefn(5, 1) = 0.125 * (-xi(0) + 2 * xi(1) - xi(2) + 1) * xp0 * xp2;
+  grad_shapefn(6, 1) = -0.125 * (-xi(0) - 2 * xi(1) - xi(2) + 1) * xp0 * xp2;
+  grad_shapefn(7, 1) = -0.125 * (xi(0) - 2 * xi(1) - xi(2) + 1) * xm0 * xp2;
+  grad_shapefn(8, 1) = -0.25 * x0sq * xm2;
+  grad_shapefn(9, 1) = -0.5 * xi(1) * xm0 * xm2;
+  grad_shapefn(10, 1) = -0.25 * x2sq * xm0;
+  grad_shapefn(11, 1) = -0.5 * xi(1) * xp0 * xm2;
+  grad_shapefn(12, 1) = -0.25 * x2sq * xp0;
+  grad_shapefn(13, 1) = 0.25 * x0sq * xm2;
+  grad_shapefn(14, 1) = 0.25 * x2sq * xp0;
+  grad_shapefn(15, 1) = 0.25 * x2sq * xm0;
+  grad_shapefn(16, 1) = -0.25 * x0sq * xp2;
+  grad_shapefn(18, 1) = -0.5 * xi(1) * xp0 * xp2;
+  grad_shapefn(19, 1) = 0.25 * x0sq * xp2;
+  grad_shapefn(17, 1) = -0.5 * xi(1) * xm0 * xp2;
+
+  grad_shapefn(0, 2) = 0.125 * (xi(0) + xi(1) + 2 * xi(2) + 1) * xm0 * xm1;
+  grad_shapefn(1, 2) = 0.125 * (-xi(0) + xi(1) + 2 * xi(2) + 1) * xp0 * xm1;
+  grad_shapefn(2, 2) = 0.125 * (-xi(0) - xi(1) + 2 * xi(2) + 1) * xp0 * xp1;
+  grad_shapefn(3, 2) = 0.125 * (xi(0) - xi(1) + 2 * xi(2) + 1) * xm0 * xp1;
+  grad_shapefn(4, 2) = -0.125 * (xi(0) + xi(1) - 2 * xi(2) + 1) * xm0 * xm1;
+  grad_shapefn(5, 2) = -0.125 * (-xi(0) + xi(1) - 2 * xi(2) + 1) * xp0 * xm1;
+  grad_shapefn(6, 2) = -0.125 * (-xi(0) - xi(1) - 2 * xi(2) + 1) * xp0 * xp1;
+  grad_shapefn(7, 2) = -0.125 * (xi(0) - xi(1) - 2 * xi(2) + 1) * xm0 * xp1;
+  grad_shapefn(8, 2) = -0.25 * x0sq * xm1;
+  grad_shapefn(9, 2) = -0.25 * x1sq * xm0;
+  grad_shapefn(10, 2) = -0.5 * xi(2) * xm0 * xm1;
+  grad_shapefn(11, 2) = -0.25 * x1sq * xp0;
+  grad_shapefn(12, 2) = -0.5 * xi(2) * xp0 * xm1;
+  grad_shapefn(13, 2) = -0.25 * x0sq * xp1;
+  grad_shapefn(14, 2) = -0.5 * xi(2) * xp0 * xp1;
+  grad_shapefn(15, 2) = -0.5 * xi(2) * xm0 * xp1;
+  grad_shapefn(16, 2) = 0.25 * x0sq * xm1;
+  grad_shapefn(18, 2) = 0.25 * x1sq * xp0;
+  grad_shapefn(19, 2) = 0.25 * x0sq * xp1;
+  grad_shapefn(17, 2) = 0.25 * x1sq * xm0;
   return grad_shapefn;
 }
 
@@ -269,9 +260,14 @@ inline Eigen::Matrix<double, Tdim, Tdim>
         const Eigen::MatrixXd& nodal_coordinates,
         Eigen::Matrix<double, 3, 1>& particle_size,
         const Eigen::Matrix<double, 3, 3>& deformation_gradient) const {
-  // Get gradient shape functions
+  // Get gradient shape functions; grad_shapefn is virtual and derived
+  // elements (GIMP, LME) return more rows than Tnfunctions, so the
+  // intermediate must stay dynamically sized
   const Eigen::MatrixXd grad_shapefn =
       this->grad_shapefn(xi, particle_size, deformation_gradient);
+#ifndef NDEBUG
+  // Dimension mismatches are programming errors; release builds skip the
+  // check and its exception machinery on this hot path
   try {
     // Check if dimensions are correct
     if ((grad_shapefn.rows() != nodal_coordinates.rows()) ||
@@ -283,6 +279,7 @@ inline Eigen::Matrix<double, Tdim, Tdim>
     console_->error("{} #{}: {}\n", __FILE__, __LINE__, exception.what());
     return Eigen::Matrix<double, Tdim, Tdim>::Zero();
   }
+#endif
 
   // Jacobian
   return (grad_shapefn.transpose() * nodal_coordinates);
@@ -306,12 +303,14 @@ template <unsigned Tdim, unsigned Tnfunctions>
 inline Eigen::MatrixXd mpm::HexahedronElement<Tdim, Tnfunctions>::dn_dx(
     const VectorDim& xi, const Eigen::MatrixXd& nodal_coordinates,
     VectorDim& particle_size, const MatrixDim& deformation_gradient) const {
-  // Get gradient shape functions
-  Eigen::MatrixXd grad_sf =
+  // Get gradient shape functions; grad_shapefn is virtual and derived
+  // elements (GIMP, LME) return more rows than Tnfunctions, so the
+  // intermediate must stay dynamically sized
+  const Eigen::MatrixXd grad_sf =
       this->grad_shapefn(xi, particle_size, deformation_gradient);
 
   // Jacobian dx_i/dxi_j
-  Eigen::Matrix<double, Tdim, Tdim> jacobian =
+  const Eigen::Matrix<double, Tdim, Tdim> jacobian =
       (grad_sf.transpose() * nodal_coordinates);
 
   // Gradient shapefn of the cell
@@ -325,14 +324,19 @@ inline std::vector<Eigen::MatrixXd>
     mpm::HexahedronElement<Tdim, Tnfunctions>::bmatrix(
         const VectorDim& xi, const Eigen::MatrixXd& nodal_coordinates,
         VectorDim& particle_size, const MatrixDim& deformation_gradient) const {
-  // Get gradient shape functions
-  Eigen::MatrixXd grad_sf =
+  // Get gradient shape functions; grad_shapefn is virtual and derived
+  // elements (GIMP, LME) return more rows than Tnfunctions, so the
+  // intermediate must stay dynamically sized
+  const Eigen::MatrixXd grad_sf =
       this->grad_shapefn(xi, particle_size, deformation_gradient);
 
   // B-Matrix
   std::vector<Eigen::MatrixXd> bmatrix;
   bmatrix.reserve(Tnfunctions);
 
+#ifndef NDEBUG
+  // Dimension mismatches are programming errors; release builds skip the
+  // check and its exception machinery on this hot path
   try {
     // Check if matrices dimensions are correct
     if ((grad_sf.rows() != nodal_coordinates.rows()) ||
@@ -344,24 +348,29 @@ inline std::vector<Eigen::MatrixXd>
     console_->error("{} #{}: {}\n", __FILE__, __LINE__, exception.what());
     return bmatrix;
   }
+#endif
 
   // Jacobian dx_i/dxi_j
-  Eigen::Matrix<double, Tdim, Tdim> jacobian =
+  const Eigen::Matrix<double, Tdim, Tdim> jacobian =
       (grad_sf.transpose() * nodal_coordinates);
 
   // Gradient shapefn of the cell
   // dN/dx = [J]^-1 * dN/dxi
-  Eigen::MatrixXd grad_shapefn = grad_sf * (jacobian.inverse()).transpose();
+  const Eigen::MatrixXd grad_shapefn =
+      grad_sf * (jacobian.inverse()).transpose();
 
+  // The zero pattern is identical for every node, so a single
+  // zero-initialised template is reused and only the nine nonzero entries
+  // are rewritten per node before being copied into the output
+  Eigen::Matrix<double, 6, Tdim> bi = Eigen::Matrix<double, 6, Tdim>::Zero();
   for (unsigned i = 0; i < Tnfunctions; ++i) {
     // clang-format off
-    Eigen::Matrix<double, 6, Tdim> bi;
-    bi(0, 0) = grad_shapefn(i, 0); bi(0, 1) = 0.;                 bi(0, 2) = 0.;
-    bi(1, 0) = 0.;                 bi(1, 1) = grad_shapefn(i, 1); bi(1, 2) = 0.;
-    bi(2, 0) = 0.;                 bi(2, 1) = 0.;                 bi(2, 2) = grad_shapefn(i, 2);
-    bi(3, 0) = grad_shapefn(i, 1); bi(3, 1) = grad_shapefn(i, 0); bi(3, 2) = 0.;
-    bi(4, 0) = 0.;                 bi(4, 1) = grad_shapefn(i, 2); bi(4, 2) = grad_shapefn(i, 1);
-    bi(5, 0) = grad_shapefn(i, 2); bi(5, 1) = 0.;                 bi(5, 2) = grad_shapefn(i, 0);
+    bi(0, 0) = grad_shapefn(i, 0);
+    bi(1, 1) = grad_shapefn(i, 1);
+    bi(2, 2) = grad_shapefn(i, 2);
+    bi(3, 0) = grad_shapefn(i, 1); bi(3, 1) = grad_shapefn(i, 0);
+    bi(4, 1) = grad_shapefn(i, 2); bi(4, 2) = grad_shapefn(i, 1);
+    bi(5, 0) = grad_shapefn(i, 2); bi(5, 2) = grad_shapefn(i, 0);
     // clang-format on
     bmatrix.push_back(bi);
   }
@@ -372,19 +381,27 @@ inline std::vector<Eigen::MatrixXd>
 template <unsigned Tdim, unsigned Tnfunctions>
 inline Eigen::MatrixXd mpm::HexahedronElement<Tdim, Tnfunctions>::ni_nj_matrix(
     const std::vector<VectorDim>& xi_s) const {
+  // The matrix depends only on the reference element and the quadrature
+  // points, yet it is requested once per cell of the mesh; memoise the last
+  // evaluation per thread so every cell after the first reuses the result
+  static thread_local std::vector<VectorDim> cached_xi_s;
+  static thread_local Eigen::Matrix<double, Tnfunctions, Tnfunctions>
+      ni_nj_matrix;
+  if (cached_xi_s == xi_s) return ni_nj_matrix;
+
   // Zeros
   Eigen::Matrix<double, Tdim, 1> zeros = Eigen::Matrix<double, Tdim, 1>::Zero();
   Eigen::Matrix<double, Tdim, Tdim> zero_matrix =
       Eigen::Matrix<double, Tdim, Tdim>::Zero();
 
   // Ni Nj matrix
-  Eigen::Matrix<double, Tnfunctions, Tnfunctions> ni_nj_matrix;
   ni_nj_matrix.setZero();
   for (const auto& xi : xi_s) {
     const Eigen::Matrix<double, Tnfunctions, 1> shape_fn =
         this->shapefn(xi, zeros, zero_matrix);
     ni_nj_matrix.noalias() += (shape_fn * shape_fn.transpose());
   }
+  cached_xi_s = xi_s;
   return ni_nj_matrix;
 }
 
@@ -395,6 +412,9 @@ inline Eigen::MatrixXd
         const std::vector<VectorDim>& xi_s,
         const Eigen::MatrixXd& nodal_coordinates) const {
 
+#ifndef NDEBUG
+  // Dimension mismatches are programming errors; release builds skip the
+  // check and its exception machinery on this hot path
   try {
     // Check if matrices dimensions are correct
     if ((this->nfunctions() != nodal_coordinates.rows()) ||
@@ -404,29 +424,47 @@ inline Eigen::MatrixXd
   } catch (std::exception& exception) {
     console_->error("{} #{}: {}\n", __FILE__, __LINE__, exception.what());
   }
-
-  // Zeros
-  Eigen::Matrix<double, Tdim, 1> zeros = Eigen::Matrix<double, Tdim, 1>::Zero();
-  Eigen::Matrix<double, Tdim, Tdim> zero_matrix =
-      Eigen::Matrix<double, Tdim, Tdim>::Zero();
+#endif
+
+  // The reference gradients depend only on the quadrature points; memoise
+  // them per thread so only the jacobian, which involves the nodal
+  // coordinates, is recomputed per cell
+  static thread_local std::vector<VectorDim> cached_xi_s;
+  static thread_local std::vector<Eigen::Matrix<double, Tnfunctions, Tdim>>
+      grad_cache;
+  if (cached_xi_s != xi_s) {
+    // Zeros
+    Eigen::Matrix<double, Tdim, 1> zeros =
+        Eigen::Matrix<double, Tdim, 1>::Zero();
+    Eigen::Matrix<double, Tdim, Tdim> zero_matrix =
+        Eigen::Matrix<double, Tdim, Tdim>::Zero();
+
+    grad_cache.resize(xi_s.size());
+    for (unsigned i = 0; i < xi_s.size(); ++i)
+      grad_cache[i] = this->grad_shapefn(xi_s[i], zeros, zero_matrix);
+    cached_xi_s = xi_s;
+  }
 
   // Laplace matrix
   Eigen::Matrix<double, Tnfunctions, Tnfunctions> laplace_matrix;
   laplace_matrix.setZero();
-  for (const auto& xi : xi_s) {
-    // Get gradient shape functions
-    const Eigen::MatrixXd grad_sf = this->grad_shapefn(xi, zeros, zero_matrix);
-
+  for (const auto& grad_sf : grad_cache) {
     // Jacobian dx_i/dxi_j
     const Eigen::Matrix<double, Tdim, Tdim> jacobian =
         (grad_sf.transpose() * nodal_coordinates);
 
     // Gradient shapefn of the cell
     // dN/dx = [J]^-1 * dN/dxi
-    const Eigen::MatrixXd grad_shapefn = grad_sf * jacobian.inverse();
+    const Eigen::Matrix<double, Tnfunctions, Tdim> grad_shapefn =
+        grad_sf * jacobian.inverse();
 
-    laplace_matrix.noalias() += (grad_shapefn * grad_shapefn.transpose());
+    // Symmetric rank-Tdim update; only the upper triangle is accumulated
+    laplace_matrix.template selfadjointView<Eigen::Upper>().rankUpdate(
+        grad_shapefn);
   }
+  // Mirror the accumulated upper triangle once after the quadrature loop
+  laplace_matrix.template triangularView<Eigen::StrictlyLower>() =
+      laplace_matrix.transpose();
   return laplace_matrix;
 }
 
@@ -448,31 +486,34 @@ inline mpm::ElementDegree mpm::HexahedronElement<3, 20>::degree() const {
 template <>
 inline Eigen::MatrixXd mpm::HexahedronElement<3, 20>::unit_cell_coordinates()
     const {
-  // Coordinates of a unit cell
-  Eigen::Matrix<double, 20, 3> unit_cell;
-  // clang-format off
-  unit_cell << -1., -1., -1.,
-                1., -1., -1.,
-                1.,  1., -1.,
-               -1.,  1., -1.,
-               -1., -1.,  1.,
-                1., -1.,  1.,
-                1.,  1.,  1.,
-               -1.,  1.,  1.,
-                0., -1., -1.,
-               -1.,  0., -1.,
-               -1., -1.,  0.,
-                1.,  0., -1.,
-                1., -1.,  0.,
-                0.,  1., -1.,
-                1.,  1.,  0.,
-               -1.,  1.,  0.,
-                0., -1.,  1.,
-               -1.,  0.,  1.,
-                1.,  0.,  1.,
+  // Coordinates of a unit cell, tabulated once
+  static const Eigen::Matrix<double, 20, 3> unit_cell = [] {
+    Eigen::Matrix<double, 20, 3> coords;
+    // clang-format off
+    coords << -1., -1., -1.,
+               1., -1., -1.,
+               1.,  1., -1.,
+              -1.,  1., -1.,
+              -1., -1.,  1.,
+               1., -1.,  1.,
+               1.,  1.,  1.,
+              -1.,  1.,  1.,
+               0., -1., -1.,
+              -1.,  0., -1.,
+              -1., -1.,  0.,
+               1.,  0., -1.,
+               1., -1.,  0.,
+               0.,  1., -1.,
+               1.,  1.,  0.,
+              -1.,  1.,  0.,
+               0., -1.,  1.,
+              -1.,  0.,  1.,
+               1.,  0.,  1.,
     // cppcheck-suppress *
-                0.,  1.,  1.;
-  // clang-format on
+               0.,  1.,  1.;
+    // clang-format on
+    return coords;
+  }();
   return unit_cell;
 }
 
@@ -509,22 +550,25 @@ inline Eigen::MatrixXd mpm::HexahedronElement<3, 20>::unit_cell_coordinates()
 template <unsigned Tdim, unsigned Tnfunctions>
 inline Eigen::MatrixXi
     mpm::HexahedronElement<Tdim, Tnfunctions>::sides_indices() const {
-  Eigen::Matrix<int, 12, 2> indices;
-  // clang-format off
-  indices << 0, 1,
-             1, 2,
-             2, 3,
-             3, 0,
-             4, 5,
-             5, 6,
-             6, 7,
-             7, 4,
-             0, 4,
-             1, 5,
-             2, 6,
+  static const Eigen::Matrix<int, 12, 2> indices = [] {
+    Eigen::Matrix<int, 12, 2> sides;
+    // clang-format off
+    sides << 0, 1,
+           1, 2,
+           2, 3,
+           3, 0,
+           4, 5,
+           5, 6,
+           6, 7,
+           7, 4,
+           0, 4,
+           1, 5,
+           2, 6,
     // cppcheck-suppress *
-             3, 7;
-  // clang-format on
+           3, 7;
+    // clang-format on
+    return sides;
+  }();
   return indices;
 }
 
@@ -535,9 +579,9 @@ inline Eigen::MatrixXi
 template <unsigned Tdim, unsigned Tnfunctions>
 inline Eigen::VectorXi
     mpm::HexahedronElement<Tdim, Tnfunctions>::corner_indices() const {
-  Eigen::Matrix<int, 8, 1> indices;
-  // cppcheck-suppress *
-  indices << 0, 1, 2, 3, 4, 5, 6, 7;
+  static const Eigen::Matrix<int, 8, 1> indices =
+      // cppcheck-suppress *
+      (Eigen::Matrix<int, 8, 1>() << 0, 1, 2, 3, 4, 5, 6, 7).finished();
   return indices;
 }
 
@@ -547,14 +591,13 @@ template <>
 inline Eigen::VectorXi mpm::HexahedronElement<3, 8>::face_indices(
     unsigned face_id) const {
 
-  //! Face ids and its associated nodal indices
-  const std::map<unsigned, Eigen::Matrix<int, 4, 1>> face_indices_hexahedron{
-      {0, Eigen::Matrix<int, 4, 1>(0, 1, 5, 4)},
-      {1, Eigen::Matrix<int, 4, 1>(5, 1, 2, 6)},
-      {2, Eigen::Matrix<int, 4, 1>(7, 6, 2, 3)},
-      {3, Eigen::Matrix<int, 4, 1>(0, 4, 7, 3)},
-      {4, Eigen::Matrix<int, 4, 1>(1, 0, 3, 2)},
-      {5, Eigen::Matrix<int, 4, 1>(4, 5, 6, 7)}};
+  //! Face ids and its associated nodal indices; constructed once instead of
+  //! rebuilding a map and its tree nodes on every call
+  static const std::array<Eigen::Matrix<int, 4, 1>, 6> face_indices_hexahedron{
+      {Eigen::Matrix<int, 4, 1>(0, 1, 5, 4), Eigen::Matrix<int, 4, 1>(5, 1, 2, 6),
+       Eigen::Matrix<int, 4, 1>(7, 6, 2, 3), Eigen::Matrix<int, 4, 1>(0, 4, 7, 3),
+       Eigen::Matrix<int, 4, 1>(1, 0, 3, 2),
+       Eigen::Matrix<int, 4, 1>(4, 5, 6, 7)}};
 
   return face_indices_hexahedron.at(face_id);
 }
@@ -565,15 +608,16 @@ template <>
 inline Eigen::VectorXi mpm::HexahedronElement<3, 20>::face_indices(
     unsigned face_id) const {
 
-  //! Face ids and its associated nodal indices
+  //! Face ids and its associated nodal indices; constructed once instead of
+  //! rebuilding a map and its tree nodes on every call
   // clang-format off
-  const std::map<unsigned, Eigen::Matrix<int, 8, 1>> face_indices_hexahedron{
-      {0, (Eigen::Matrix<int, 8, 1>() << 0, 1, 5, 4,  8, 12, 16, 10).finished()},
-      {1, (Eigen::Matrix<int, 8, 1>() << 5, 1, 2, 6, 12, 11, 14, 18).finished()},
-      {2, (Eigen::Matrix<int, 8, 1>() << 7, 6, 2, 3, 19, 14, 13, 15).finished()},
-      {3, (Eigen::Matrix<int, 8, 1>() << 0, 4, 7, 3, 10, 17, 15,  9).finished()},
-      {4, (Eigen::Matrix<int, 8, 1>() << 1, 0, 3, 2,  8,  9, 13, 11).finished()},
-      {5, (Eigen::Matrix<int, 8, 1>() << 4, 5, 6, 7, 16, 18, 19, 17).finished()}};
+  static const std::array<Eigen::Matrix<int, 8, 1>, 6> face_indices_hexahedron{
+      {(Eigen::Matrix<int, 8, 1>() << 0, 1, 5, 4,  8, 12, 16, 10).finished(),
+       (Eigen::Matrix<int, 8, 1>() << 5, 1, 2, 6, 12, 11, 14, 18).finished(),
+       (Eigen::Matrix<int, 8, 1>() << 7, 6, 2, 3, 19, 14, 13, 15).finished(),
+       (Eigen::Matrix<int, 8, 1>() << 0, 4, 7, 3, 10, 17, 15,  9).finished(),
+       (Eigen::Matrix<int, 8, 1>() << 1, 0, 3, 2,  8,  9, 13, 11).finished(),
+       (Eigen::Matrix<int, 8, 1>() << 4, 5, 6, 7, 16, 18, 19, 17).finished()}};
   // clang-format on
 
   return face_indices_hexahedron.at(face_id);
@@ -584,22 +628,30 @@ template <unsigned Tdim, unsigned Tnfunctions>
 inline std::shared_ptr<mpm::Quadrature<Tdim>>
     mpm::HexahedronElement<Tdim, Tnfunctions>::quadrature(
         unsigned nquadratures) const {
+  // Quadratures are stateless; construct each rule once and share it instead
+  // of resolving the factory registry string per call
   switch (nquadratures) {
+    case 2: {
+      static const auto quadrature =
+          std::make_shared<mpm::HexahedronQuadrature<Tdim, 8>>();
+      return quadrature;
+    }
+    case 3: {
+      static const auto quadrature =
+          std::make_shared<mpm::HexahedronQuadrature<Tdim, 27>>();
+      return quadrature;
+    }
+    case 4: {
+      static const auto quadrature =
+          std::make_shared<mpm::HexahedronQuadrature<Tdim, 64>>();
+      return quadrature;
+    }
     case 1:
-      return Factory<mpm::Quadrature<Tdim>>::instance()->create("QHEX1");
-      break;
-    case 2:
-      return Factory<mpm::Quadrature<Tdim>>::instance()->create("QHEX2");
-      break;
-    case 3:
-      return Factory<mpm::Quadrature<Tdim>>::instance()->create("QHEX3");
-      break;
-    case 4:
-      return Factory<mpm::Quadrature<Tdim>>::instance()->create("QHEX4");
-      break;
-    default:
-      return Factory<mpm::Quadrature<Tdim>>::instance()->create("QHEX1");
-      break;
+    default: {
+      static const auto quadrature =
+          std::make_shared<mpm::HexahedronQuadrature<Tdim, 1>>();
+      return quadrature;
+    }
   }
 }
 
@@ -635,14 +687,23 @@ inline double mpm::HexahedronElement<Tdim, Tnfunctions>::compute_volume(
   const Eigen::Matrix<double, Tdim, 1> g = nodal_coordinates.row(1);
   const Eigen::Matrix<double, Tdim, 1> h = nodal_coordinates.row(0);
 
+  // Hoist the repeated edge vectors and cross products into locals so each
+  // is evaluated once and stays in registers
+  const Eigen::Matrix<double, Tdim, 1> ag = a - g;
+  const Eigen::Matrix<double, Tdim, 1> bg = b - g;
+  const Eigen::Matrix<double, Tdim, 1> eg = e - g;
+  const Eigen::Matrix<double, Tdim, 1> dg = d - g;
+  const Eigen::Matrix<double, Tdim, 1> bd_x_ca = (b - d).cross(c - a);
+  const Eigen::Matrix<double, Tdim, 1> eb_x_fa = (e - b).cross(f - a);
+  const Eigen::Matrix<double, Tdim, 1> de_x_ha = (d - e).cross(h - a);
+  const Eigen::Matrix<double, Tdim, 1> cg_x_cf = (c - g).cross(c - f);
+  const Eigen::Matrix<double, Tdim, 1> fg_x_hf = (f - g).cross(h - f);
+  const Eigen::Matrix<double, Tdim, 1> hg_x_hc = (h - g).cross(h - c);
+
   const double volume =
-      (1.0 / 12) * (a - g).dot(((b - d).cross(c - a)) + ((e - b).cross(f - a)) +
-                               ((d - e).cross(h - a))) +
-      (1.0 / 12) *
-          (b - g).dot(((b - d).cross(c - a)) + ((c - g).cross(c - f))) +
-      (1.0 / 12) *
-          (e - g).dot(((e - b).cross(f - a)) + ((f - g).cross(h - f))) +
-      (1.0 / 12) * (d - g).dot(((d - e).cross(h - a)) + ((h - g).cross(h - c)));
+      (1.0 / 12) * (ag.dot(bd_x_ca + eb_x_fa + de_x_ha) +
+                    bg.dot(bd_x_ca + cg_x_cf) + eg.dot(eb_x_fa + fg_x_hf) +
+                    dg.dot(de_x_ha + hg_x_hc));
 
   return volume;
 }
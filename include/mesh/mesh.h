@@ -3,6 +3,7 @@
 
 #include <algorithm>
 #include <array>
+#include <cstring>
 #include <limits>
 #include <memory>
 #include <numeric>
@@ -266,6 +267,11 @@ class Mesh {
   //! \retval particles Particles which cannot be located in the mesh
   std::vector<std::shared_ptr<mpm::ParticleBase<Tdim>>> locate_particles_mesh();
 
+  //! Sort particles by the id of the cell they are located in, so particles
+  //! of the same cell are contiguous and share nodal cache lines when
+  //! mapping to nodes
+  void sort_particles_by_cell();
+
   //! Iterate over particles
   //! \tparam Toper Callable object typically a baseclass functor
   template <typename Toper>
@@ -285,11 +285,13 @@ void mpm::Mesh<Tdim>::iterate_over_cells(Toper oper) {
 template <unsigned Tdim>
 void mpm::Mesh<Tdim>::find_cell_neighbours() {
   // Initialize and compute node cell map
-  tsl::robin_map<mpm::Index, std::set<mpm::Index>> node_cell_map;
+  // Each (node, cell) pair is visited exactly once, so a flat vector per
+  // node avoids the per-entry heap nodes of a std::set bucket
+  tsl::robin_map<mpm::Index, std::vector<mpm::Index>> node_cell_map;
   for (auto citr = cells_.cbegin(); citr != cells_.cend(); ++citr) {
     // Populate node_cell_map with the node_id and multiple cell_id
     auto cell_id = (*citr)->id();
-    for (auto id : (*citr)->nodes_id()) node_cell_map[id].insert(cell_id);
+    for (auto id : (*citr)->nodes_id()) node_cell_map[id].emplace_back(cell_id);
   }
 
 #pragma omp parallel for schedule(runtime)
@@ -672,6 +674,15 @@ bool mpm::Mesh<Tdim>::remove_particle_by_id(mpm::Index id) {
   return (result && map_particles_.remove(id));
 }
 
+//! Sort particles by the id of the cell they are located in
+template <unsigned Tdim>
+void mpm::Mesh<Tdim>::sort_particles_by_cell() {
+  particles_.sort([](const std::shared_ptr<mpm::ParticleBase<Tdim>>& first,
+                     const std::shared_ptr<mpm::ParticleBase<Tdim>>& second) {
+    return first->cell_id() < second->cell_id();
+  });
+}
+
 //! Remove a particle by id
 template <unsigned Tdim>
 void mpm::Mesh<Tdim>::remove_particles(const std::vector<mpm::Index>& pids) {
@@ -1580,26 +1591,9 @@ bool mpm::Mesh<Tdim>::write_particles_hdf5(const std::string& filename) {
     particle_data.emplace_back(*pod);
   }
 
-  // Calculate the size and the offsets of our struct members in memory
-  const hsize_t NRECORDS = nparticles;
-  const hsize_t NFIELDS = mpm::pod::particle::NFIELDS;
-
-  hid_t file_id;
-  hsize_t chunk_size = 10000;
-  int* fill_data = NULL;
-  int compress = 0;
-
-  // Create a new file using default properties.
-  file_id =
-      H5Fcreate(filename.c_str(), H5F_ACC_TRUNC, H5P_DEFAULT, H5P_DEFAULT);
-
-  // make a table
-  H5TBmake_table("Table Title", file_id, "table", NFIELDS, NRECORDS,
-                 mpm::pod::particle::dst_size, mpm::pod::particle::field_names,
-                 mpm::pod::particle::dst_offset, mpm::pod::particle::field_type,
-                 chunk_size, fill_data, compress, particle_data.data());
-
-  H5Fclose(file_id);
+  // Snapshot gathered; the columnar file write is shared with the
+  // asynchronous output path
+  mpm::pod::particle::write_particles(filename, particle_data);
   return true;
 }
 
@@ -1666,20 +1660,58 @@ bool mpm::Mesh<Tdim>::read_particles_hdf5(const std::string& filename,
   // Throw an error if file can't be found
   if (file_id < 0) throw std::runtime_error("HDF5 particle file is not found");
 
-  // Calculate the size and the offsets of our struct members in memory
+  // Number of records from the extent of the id dataset
+  hid_t id_dataset = H5Dopen2(file_id, "id", H5P_DEFAULT);
+  if (id_dataset < 0)
+    throw std::runtime_error("HDF5 particle file has no id dataset");
+  hid_t id_space = H5Dget_space(id_dataset);
   hsize_t nrecords = 0;
-  hsize_t nfields = 0;
-  H5TBget_table_info(file_id, "table", &nfields, &nrecords);
-
-  if (nfields != mpm::pod::particle::NFIELDS)
-    throw std::runtime_error("HDF5 table has incorrect number of fields");
+  H5Sget_simple_extent_dims(id_space, &nrecords, nullptr);
+  H5Sclose(id_space);
+  H5Dclose(id_dataset);
+
+  // Scalar fields; the trailing state variables are one [nrecords][NSVARS]
+  // dataset
+  const hsize_t nscalar_fields =
+      mpm::pod::particle::NFIELDS - mpm::pod::particle::NSVARS;
+
+  std::vector<PODParticle> dst_buf(nrecords);
+  char* base = reinterpret_cast<char*>(dst_buf.data());
+  std::vector<char> column;
+  // Read each field dataset and scatter it into the particle records
+  for (hsize_t field = 0; field < nscalar_fields; ++field) {
+    hid_t dataset_id =
+        H5Dopen2(file_id, mpm::pod::particle::field_names[field], H5P_DEFAULT);
+    if (dataset_id < 0)
+      throw std::runtime_error("HDF5 particle file has missing field datasets");
+
+    const size_t size = mpm::pod::particle::dst_sizes[field];
+    const size_t offset = mpm::pod::particle::dst_offset[field];
+    column.resize(size * nrecords);
+    H5Dread(dataset_id, mpm::pod::particle::field_type[field], H5S_ALL,
+            H5S_ALL, H5P_DEFAULT, column.data());
+    H5Dclose(dataset_id);
+    for (hsize_t i = 0; i < nrecords; ++i)
+      std::memcpy(base + i * sizeof(PODParticle) + offset, &column[i * size],
+                  size);
+  }
 
-  std::vector<PODParticle> dst_buf;
-  dst_buf.reserve(nrecords);
-  // Read the table
-  H5TBread_table(file_id, "table", mpm::pod::particle::dst_size,
-                 mpm::pod::particle::dst_offset, mpm::pod::particle::dst_sizes,
-                 dst_buf.data());
+  // State variables
+  {
+    hid_t dataset_id = H5Dopen2(file_id, "svars", H5P_DEFAULT);
+    if (dataset_id < 0)
+      throw std::runtime_error("HDF5 particle file has missing field datasets");
+
+    const size_t offset = mpm::pod::particle::dst_offset[nscalar_fields];
+    const size_t row_size = sizeof(double) * mpm::pod::particle::NSVARS;
+    column.resize(row_size * nrecords);
+    H5Dread(dataset_id, H5T_NATIVE_DOUBLE, H5S_ALL, H5S_ALL, H5P_DEFAULT,
+            column.data());
+    H5Dclose(dataset_id);
+    for (hsize_t i = 0; i < nrecords; ++i)
+      std::memcpy(base + i * sizeof(PODParticle) + offset,
+                  &column[i * row_size], row_size);
+  }
 
   // Iterate over all HDF5 particles
   for (unsigned i = 0; i < nrecords; ++i) {
@@ -670,11 +670,12 @@ bool mpm::Node<Tdim, Tdof, Tnphases>::apply_absorbing_constraint(
       // Get material id
       auto mat_id = material_ids_.begin();
 
-      // Extract material properties and displacements
-      double pwave_v = this->property_handle_->property(
-          "wave_velocities", prop_id_, *mat_id, 2)(0);
-      double swave_v = this->property_handle_->property(
-          "wave_velocities", prop_id_, *mat_id, 2)(1);
+      // Extract material properties and displacements; fetch each nodal
+      // property once rather than per component
+      const Eigen::MatrixXd wave_velocities = this->property_handle_->property(
+          "wave_velocities", prop_id_, *mat_id, 2);
+      double pwave_v = wave_velocities(0);
+      double swave_v = wave_velocities(1);
       double density =
           this->property_handle_->property("density", prop_id_, *mat_id)(0);
       Eigen::Matrix<double, Tdim, 1> material_displacement =
@@ -682,10 +683,11 @@ bool mpm::Node<Tdim, Tdof, Tnphases>::apply_absorbing_constraint(
                                            Tdim);
 
       // Update quantities based on nodal mass
-      pwave_v /= this->mass(*mat_id);
-      swave_v /= this->mass(*mat_id);
-      density /= this->mass(*mat_id);
-      material_displacement /= this->mass(*mat_id);
+      const double mass = this->mass(*mat_id);
+      pwave_v /= mass;
+      swave_v /= mass;
+      density /= mass;
+      material_displacement /= mass;
 
       // Wave velocity Eigen Matrix
       Eigen::Matrix<double, Tdim, 1> wave_velocity =
@@ -592,7 +592,7 @@ class ParticleBase {
   //! Cell
   std::shared_ptr<Cell<Tdim>> cell_;
   //! Vector of nodal pointers
-  std::vector<std::shared_ptr<NodeBase<Tdim>>> nodes_;
+  std::vector<NodeBase<Tdim>*> nodes_;
   //! Material
   std::vector<std::shared_ptr<Material<Tdim>>> material_;
   //! Unsigned material id
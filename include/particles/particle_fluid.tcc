@@ -154,8 +154,10 @@ template <unsigned Tdim>
 bool mpm::FluidParticle<Tdim>::map_poisson_right_to_cell() {
   bool status = true;
   try {
-    // Compute local poisson rhs matrix
-    cell_->compute_local_poisson_right(
+    // Compute local poisson rhs and correction matrices in a single fused
+    // sweep; the correction matrix shares the same inputs and is consumed
+    // later in compute_correction_force
+    cell_->compute_local_poisson_right_and_correction(
         shapefn_, dn_dx_, volume_,
         this->material(mpm::ParticlePhase::SinglePhase)
             ->template property<double>(std::string("density")));
@@ -1,6 +1,9 @@
 #ifndef MPM_POD_H_
 #define MPM_POD_H_
 
+#include <string>
+#include <vector>
+
 // HDF5
 #include "hdf5.h"
 #include "hdf5_hl.h"
@@ -56,6 +59,10 @@ namespace pod {
 namespace particle {
 const hsize_t NFIELDS = 64;
 
+// Number of state variables; stored on disk as one [nparticles][NSVARS]
+// dataset rather than NSVARS scalar columns
+const hsize_t NSVARS = 20;
+
 const size_t dst_size = sizeof(PODParticle);
 
 // Destination offset
@@ -70,6 +77,12 @@ extern const char* field_names[NFIELDS];
 // Initialize field types
 extern const hid_t field_type[NFIELDS];
 
+//! Write particles to an HDF5 file with one dataset per field
+//! \param[in] filename Output HDF5 file name
+//! \param[in] particle_data Snapshot of particle records to write
+void write_particles(const std::string& filename,
+                     const std::vector<PODParticle>& particle_data);
+
 }  // namespace particle
 }  // namespace pod
 
@@ -1,6 +1,7 @@
 #ifndef MPM_MPM_BASE_H_
 #define MPM_MPM_BASE_H_
 
+#include <future>
 #include <numeric>
 
 #include <boost/lexical_cast.hpp>
@@ -81,6 +82,11 @@ class MPMBase : public MPM {
   //! \param[in] initial_step Start of simulation or later steps
   void mpi_domain_decompose(bool initial_step = false) override;
 
+  //! Check if the particle load is imbalanced across MPI ranks
+  //! \retval imbalanced True if the particle-count spread between ranks
+  //! exceeds the load balance tolerance
+  bool mpi_load_imbalanced() const;
+
   //! Output results
   //! \param[in] step Time step
   void write_outputs(mpm::Index step) override;
@@ -257,6 +263,11 @@ class MPMBase : public MPM {
   Eigen::Matrix<double, Tdim, 1> gravity_;
   //! Mesh object
   std::shared_ptr<mpm::Mesh<Tdim>> mesh_;
+  //! Relative particle-count spread across ranks that triggers a repartition
+  double load_balance_tolerance_{0.15};
+  //! Pending asynchronous particle checkpoint write, joined before the next
+  //! HDF5 operation and on destruction
+  std::future<void> hdf5_async_write_;
   //! Constraints object
   std::shared_ptr<mpm::Constraints<Tdim>> constraints_;
   //! Particle types
@@ -526,10 +526,20 @@ void mpm::MPMBase<Tdim>::write_hdf5(mpm::Index step, mpm::Index max_steps) {
     auto particles_file =
         io_->output_file(attribute, extension, uuid_, step, max_steps).string();
 
-    // Load particle information from file
-    if (attribute == "particles" || attribute == "fluid_particles")
-      mesh_->write_particles_hdf5(particles_file);
-    else if (attribute == "twophase_particles")
+    // The HDF5 library is not thread safe; finish any outstanding
+    // asynchronous write before issuing another HDF5 operation
+    if (hdf5_async_write_.valid()) hdf5_async_write_.get();
+
+    if (attribute == "particles" || attribute == "fluid_particles") {
+      // Snapshot the particle state now and overlap the file write with
+      // the next step's compute; the future is joined before the next
+      // HDF5 call and on destruction of the solver
+      hdf5_async_write_ = std::async(
+          std::launch::async,
+          [particles_file, particle_data = mesh_->particles_hdf5()]() {
+            mpm::pod::particle::write_particles(particles_file, particle_data);
+          });
+    } else if (attribute == "twophase_particles")
       mesh_->write_particles_hdf5_twophase(particles_file);
   }
 }
@@ -1571,6 +1581,30 @@ bool mpm::MPMBase<Tdim>::initialise_damping(const Json& damping_props) {
   return status;
 }
 
+//! Check if the particle load is imbalanced across MPI ranks
+template <unsigned Tdim>
+bool mpm::MPMBase<Tdim>::mpi_load_imbalanced() const {
+  bool imbalanced = false;
+#ifdef USE_MPI
+  int mpi_size = 1;
+  MPI_Comm_size(MPI_COMM_WORLD, &mpi_size);
+  if (mpi_size > 1) {
+    // Gather the extreme particle counts across ranks; two 8-byte
+    // allreduces are far cheaper than a needless repartition
+    unsigned long long nlocal = mesh_->nparticles();
+    unsigned long long nmax = 0;
+    unsigned long long nmin = 0;
+    MPI_Allreduce(&nlocal, &nmax, 1, MPI_UNSIGNED_LONG_LONG, MPI_MAX,
+                  MPI_COMM_WORLD);
+    MPI_Allreduce(&nlocal, &nmin, 1, MPI_UNSIGNED_LONG_LONG, MPI_MIN,
+                  MPI_COMM_WORLD);
+    // Repartition only when the spread exceeds the tolerance
+    imbalanced = (nmax - nmin) > load_balance_tolerance_ * nmax;
+  }
+#endif
+  return imbalanced;
+}
+
 //! Domain decomposition
 template <unsigned Tdim>
 void mpm::MPMBase<Tdim>::mpi_domain_decompose(bool initial_step) {
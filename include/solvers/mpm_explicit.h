@@ -6,6 +6,7 @@
 #endif
 
 #include "mpm_base.h"
+#include "stage_timer.h"
 
 namespace mpm {
 
@@ -91,8 +91,10 @@ bool mpm::MPMExplicit<Tdim>::solve() {
     this->initialise_particles();
 
     // Compute mass
-    mesh_->iterate_over_particles(std::bind(
-        &mpm::ParticleBase<Tdim>::compute_mass, std::placeholders::_1));
+    mesh_->iterate_over_particles(
+        [](const std::shared_ptr<mpm::ParticleBase<Tdim>>& particle) {
+          particle->compute_mass();
+        });
 
     // Domain decompose
     this->mpi_domain_decompose(initial_step);
@@ -108,6 +110,8 @@ bool mpm::MPMExplicit<Tdim>::solve() {
   if (!resume) this->write_outputs(this->step_);
 
   auto solver_begin = std::chrono::steady_clock::now();
+  // Per-stage timer; no-op unless the build defines MPM_PROFILE
+  mpm::StageTimer stage_timer;
   // Main loop
   for (; step_ < nsteps_; ++step_) {
 
@@ -115,8 +119,10 @@ bool mpm::MPMExplicit<Tdim>::solve() {
 
 #ifdef USE_MPI
 #ifdef USE_GRAPH_PARTITIONING
-    // Run load balancer at a specified frequency
-    if (step_ % nload_balance_steps_ == 0 && step_ != 0)
+    // Run load balancer at a specified frequency, skipping the costly
+    // repartition while particle counts remain balanced across ranks
+    if (step_ % nload_balance_steps_ == 0 && step_ != 0 &&
+        this->mpi_load_imbalanced())
       this->mpi_domain_decompose(false);
 #endif
 #endif
@@ -124,24 +130,29 @@ bool mpm::MPMExplicit<Tdim>::solve() {
     // Inject particles
     mesh_->inject_particles(step_ * dt_);
 
+    stage_timer.start();
     // Initialise nodes, cells and shape functions
     mpm_scheme_->initialise();
+    stage_timer.lap("initialise");
 
     // Initialise nodal properties and append material ids to node
     contact_->initialise();
 
     // Mass momentum and compute velocity at nodes
     mpm_scheme_->compute_nodal_kinematics(phase);
+    stage_timer.lap("nodal kinematics");
 
     // Map material properties to nodes
     contact_->compute_contact_forces();
 
     // Update stress first
     mpm_scheme_->precompute_stress_strain(phase, pressure_smoothing_);
+    stage_timer.lap("precompute stress strain");
 
     // Compute forces
     mpm_scheme_->compute_forces(gravity_, phase, step_,
                                 set_node_concentrated_force_);
+    stage_timer.lap("compute forces");
 
     // Apply Absorbing Constraint
     if (absorbing_boundary_) {
@@ -153,27 +164,39 @@ bool mpm::MPMExplicit<Tdim>::solve() {
     mpm_scheme_->compute_particle_kinematics(velocity_update_, phase, "Cundall",
                                              damping_factor_, step_,
                                              update_defgrad_);
+    stage_timer.lap("particle kinematics");
 
     // Mass momentum and compute velocity at nodes
     mpm_scheme_->postcompute_nodal_kinematics(phase);
 
     // Update Stress Last
     mpm_scheme_->postcompute_stress_strain(phase, pressure_smoothing_);
+    stage_timer.lap("postcompute stress strain");
 
     // Locate particles
     mpm_scheme_->locate_particles(this->locate_particles_);
+    stage_timer.lap("locate particles");
+
+    // Periodically restore spatial locality of the particle container
+    if (step_ % nload_balance_steps_ == 0 && step_ != 0)
+      mesh_->sort_particles_by_cell();
 
 #ifdef USE_MPI
 #ifdef USE_GRAPH_PARTITIONING
+    // The halo exchange completes pairwise (matched sends/receives plus
+    // MPI_Wait on the send requests), so no global barrier is needed and
+    // ranks proceed to output as soon as their own transfers finish
     mesh_->transfer_halo_particles();
-    MPI_Barrier(MPI_COMM_WORLD);
 #endif
 #endif
 
+    stage_timer.start();
     // Write outputs
     this->write_outputs(this->step_ + 1);
+    stage_timer.lap("write outputs");
   }
   auto solver_end = std::chrono::steady_clock::now();
+  stage_timer.report(console_);
   console_->info("Rank {}, Explicit {} solver duration: {} ms", mpi_rank,
                  mpm_scheme_->scheme(),
                  std::chrono::duration_cast<std::chrono::milliseconds>(
@@ -24,17 +24,21 @@ inline void mpm::MPMScheme<Tdim>::initialise() {
     {
       // Initialise nodes
       mesh_->iterate_over_nodes(
-          std::bind(&mpm::NodeBase<Tdim>::initialise, std::placeholders::_1));
+          [](const std::shared_ptr<mpm::NodeBase<Tdim>>& node) {
+            node->initialise();
+          });
 
-      mesh_->iterate_over_cells(
-          std::bind(&mpm::Cell<Tdim>::activate_nodes, std::placeholders::_1));
+      mesh_->iterate_over_cells([](const std::shared_ptr<mpm::Cell<Tdim>>&
+                                       cell) { cell->activate_nodes(); });
     }
     // Spawn a task for particles
 #pragma omp section
     {
       // Iterate over each particle to compute shapefn
-      mesh_->iterate_over_particles(std::bind(
-          &mpm::ParticleBase<Tdim>::compute_shapefn, std::placeholders::_1));
+      mesh_->iterate_over_particles(
+          [](const std::shared_ptr<mpm::ParticleBase<Tdim>>& particle) {
+            particle->compute_shapefn();
+          });
     }
   }  // Wait to complete
 }
@@ -44,29 +48,41 @@ template <unsigned Tdim>
 inline void mpm::MPMScheme<Tdim>::compute_nodal_kinematics(unsigned phase) {
   // Assign mass and momentum to nodes
   mesh_->iterate_over_particles(
-      std::bind(&mpm::ParticleBase<Tdim>::map_mass_momentum_to_nodes,
-                std::placeholders::_1));
+      [](const std::shared_ptr<mpm::ParticleBase<Tdim>>& particle) {
+        particle->map_mass_momentum_to_nodes();
+      });
 
 #ifdef USE_MPI
   // Run if there is more than a single MPI task
   if (mpi_size_ > 1) {
     // MPI all reduce nodal mass
     mesh_->template nodal_halo_exchange<double, 1>(
-        std::bind(&mpm::NodeBase<Tdim>::mass, std::placeholders::_1, phase),
-        std::bind(&mpm::NodeBase<Tdim>::update_mass, std::placeholders::_1,
-                  false, phase, std::placeholders::_2));
+        [phase](const std::shared_ptr<mpm::NodeBase<Tdim>>& node) {
+          return node->mass(phase);
+        },
+        [phase](const std::shared_ptr<mpm::NodeBase<Tdim>>& node, double mass) {
+          node->update_mass(false, phase, mass);
+        });
     // MPI all reduce nodal momentum
     mesh_->template nodal_halo_exchange<Eigen::Matrix<double, Tdim, 1>, Tdim>(
-        std::bind(&mpm::NodeBase<Tdim>::momentum, std::placeholders::_1, phase),
-        std::bind(&mpm::NodeBase<Tdim>::update_momentum, std::placeholders::_1,
-                  false, phase, std::placeholders::_2));
+        [phase](const std::shared_ptr<mpm::NodeBase<Tdim>>& node) {
+          return node->momentum(phase);
+        },
+        [phase](const std::shared_ptr<mpm::NodeBase<Tdim>>& node,
+                const Eigen::Matrix<double, Tdim, 1>& momentum) {
+          node->update_momentum(false, phase, momentum);
+        });
   }
 #endif
 
   // Compute nodal velocity
   mesh_->iterate_over_nodes_predicate(
-      std::bind(&mpm::NodeBase<Tdim>::compute_velocity, std::placeholders::_1),
-      std::bind(&mpm::NodeBase<Tdim>::status, std::placeholders::_1));
+      [](const std::shared_ptr<mpm::NodeBase<Tdim>>& node) {
+        node->compute_velocity();
+      },
+      [](const std::shared_ptr<mpm::NodeBase<Tdim>>& node) {
+        return node->status();
+      });
 }
 
 //! Compute stress and strain
@@ -74,20 +90,42 @@ template <unsigned Tdim>
 inline void mpm::MPMScheme<Tdim>::compute_stress_strain(
     unsigned phase, bool pressure_smoothing) {
 
+  const double dt = dt_;
+  if (!pressure_smoothing) {
+    // The strain, volume and stress updates are independent per particle, so
+    // fuse them into one sweep; the particle's state is still hot in cache
+    // for the stress update instead of being re-fetched in a third pass
+    mesh_->iterate_over_particles(
+        [dt](const std::shared_ptr<mpm::ParticleBase<Tdim>>& particle) {
+          particle->compute_strain(dt);
+          particle->update_volume();
+          particle->compute_stress();
+        });
+    return;
+  }
+
+  // With pressure smoothing a nodal pass separates the volume and stress
+  // updates, so the sweeps cannot be fused
   // Iterate over each particle to calculate strain
-  mesh_->iterate_over_particles(std::bind(
-      &mpm::ParticleBase<Tdim>::compute_strain, std::placeholders::_1, dt_));
+  mesh_->iterate_over_particles(
+      [dt](const std::shared_ptr<mpm::ParticleBase<Tdim>>& particle) {
+        particle->compute_strain(dt);
+      });
 
   // Iterate over each particle to update particle volume
-  mesh_->iterate_over_particles(std::bind(
-      &mpm::ParticleBase<Tdim>::update_volume, std::placeholders::_1));
+  mesh_->iterate_over_particles(
+      [](const std::shared_ptr<mpm::ParticleBase<Tdim>>& particle) {
+        particle->update_volume();
+      });
 
   // Pressure smoothing
-  if (pressure_smoothing) this->pressure_smoothing(phase);
+  this->pressure_smoothing(phase);
 
   // Iterate over each particle to compute stress
-  mesh_->iterate_over_particles(std::bind(
-      &mpm::ParticleBase<Tdim>::compute_stress, std::placeholders::_1));
+  mesh_->iterate_over_particles(
+      [](const std::shared_ptr<mpm::ParticleBase<Tdim>>& particle) {
+        particle->compute_stress();
+      });
 }
 
 //! Pressure smoothing
@@ -95,23 +133,27 @@ template <unsigned Tdim>
 inline void mpm::MPMScheme<Tdim>::pressure_smoothing(unsigned phase) {
   // Assign pressure to nodes
   mesh_->iterate_over_particles(
-      std::bind(&mpm::ParticleBase<Tdim>::map_pressure_to_nodes,
-                std::placeholders::_1, phase));
+      [phase](const std::shared_ptr<mpm::ParticleBase<Tdim>>& particle) {
+        particle->map_pressure_to_nodes(phase);
+      });
 
 #ifdef USE_MPI
   // Run if there is more than a single MPI task
   if (mpi_size_ > 1)
     // MPI all reduce nodal pressure
     mesh_->template nodal_halo_exchange<double, 1>(
-        std::bind(&mpm::NodeBase<Tdim>::pressure, std::placeholders::_1, phase),
-        std::bind(&mpm::NodeBase<Tdim>::assign_pressure, std::placeholders::_1,
-                  phase, std::placeholders::_2));
+        [phase](const std::shared_ptr<mpm::NodeBase<Tdim>>& node) {
+          return node->pressure(phase);
+        },
+        [phase](const std::shared_ptr<mpm::NodeBase<Tdim>>& node,
+                double pressure) { node->assign_pressure(phase, pressure); });
 #endif
 
   // Smooth pressure over particles
   mesh_->iterate_over_particles(
-      std::bind(&mpm::ParticleBase<Tdim>::compute_pressure_smoothing,
-                std::placeholders::_1, phase));
+      [phase](const std::shared_ptr<mpm::ParticleBase<Tdim>>& particle) {
+        particle->compute_pressure_smoothing(phase);
+      });
 }
 
 // Compute forces
@@ -126,26 +168,33 @@ inline void mpm::MPMScheme<Tdim>::compute_forces(
     {
       // Iterate over each particle to compute nodal body force
       mesh_->iterate_over_particles(
-          std::bind(&mpm::ParticleBase<Tdim>::map_body_force,
-                    std::placeholders::_1, gravity));
+          [&gravity](const std::shared_ptr<mpm::ParticleBase<Tdim>>& particle) {
+            particle->map_body_force(gravity);
+          });
 
       // Apply particle traction and map to nodes
       mesh_->apply_traction_on_particles(step * dt_);
 
       // Iterate over each node to add concentrated node force to external
       // force
-      if (concentrated_nodal_forces)
+      if (concentrated_nodal_forces) {
+        const double current_time = step * dt_;
         mesh_->iterate_over_nodes(
-            std::bind(&mpm::NodeBase<Tdim>::apply_concentrated_force,
-                      std::placeholders::_1, phase, (step * dt_)));
+            [phase,
+             current_time](const std::shared_ptr<mpm::NodeBase<Tdim>>& node) {
+              node->apply_concentrated_force(phase, current_time);
+            });
+      }
     }
 
 #pragma omp section
     {
       // Spawn a task for internal force
       // Iterate over each particle to compute nodal internal force
-      mesh_->iterate_over_particles(std::bind(
-          &mpm::ParticleBase<Tdim>::map_internal_force, std::placeholders::_1));
+      mesh_->iterate_over_particles(
+          [](const std::shared_ptr<mpm::ParticleBase<Tdim>>& particle) {
+            particle->map_internal_force();
+          });
     }
   }  // Wait for tasks to finish
 
@@ -154,16 +203,22 @@ inline void mpm::MPMScheme<Tdim>::compute_forces(
   if (mpi_size_ > 1) {
     // MPI all reduce external force
     mesh_->template nodal_halo_exchange<Eigen::Matrix<double, Tdim, 1>, Tdim>(
-        std::bind(&mpm::NodeBase<Tdim>::external_force, std::placeholders::_1,
-                  phase),
-        std::bind(&mpm::NodeBase<Tdim>::update_external_force,
-                  std::placeholders::_1, false, phase, std::placeholders::_2));
+        [phase](const std::shared_ptr<mpm::NodeBase<Tdim>>& node) {
+          return node->external_force(phase);
+        },
+        [phase](const std::shared_ptr<mpm::NodeBase<Tdim>>& node,
+                const Eigen::Matrix<double, Tdim, 1>& force) {
+          node->update_external_force(false, phase, force);
+        });
     // MPI all reduce internal force
     mesh_->template nodal_halo_exchange<Eigen::Matrix<double, Tdim, 1>, Tdim>(
-        std::bind(&mpm::NodeBase<Tdim>::internal_force, std::placeholders::_1,
-                  phase),
-        std::bind(&mpm::NodeBase<Tdim>::update_internal_force,
-                  std::placeholders::_1, false, phase, std::placeholders::_2));
+        [phase](const std::shared_ptr<mpm::NodeBase<Tdim>>& node) {
+          return node->internal_force(phase);
+        },
+        [phase](const std::shared_ptr<mpm::NodeBase<Tdim>>& node,
+                const Eigen::Matrix<double, Tdim, 1>& force) {
+          node->update_internal_force(false, phase, force);
+        });
   }
 #endif
 }
@@ -176,16 +231,19 @@ inline void mpm::MPMScheme<Tdim>::absorbing_boundary_properties() {
 
   // Append material ids to nodes
   mesh_->iterate_over_particles(
-      std::bind(&mpm::ParticleBase<Tdim>::append_material_id_to_nodes,
-                std::placeholders::_1));
+      [](const std::shared_ptr<mpm::ParticleBase<Tdim>>& particle) {
+        particle->append_material_id_to_nodes();
+      });
 
   mesh_->iterate_over_particles(
-      std::bind(&mpm::ParticleBase<Tdim>::map_wave_velocities_to_nodes,
-                std::placeholders::_1));
+      [](const std::shared_ptr<mpm::ParticleBase<Tdim>>& particle) {
+        particle->map_wave_velocities_to_nodes();
+      });
   // Map multimaterial displacements from particles to nodes
-  mesh_->iterate_over_particles(std::bind(
-      &mpm::ParticleBase<Tdim>::map_multimaterial_displacements_to_nodes,
-      std::placeholders::_1));
+  mesh_->iterate_over_particles(
+      [](const std::shared_ptr<mpm::ParticleBase<Tdim>>& particle) {
+        particle->map_multimaterial_displacements_to_nodes();
+      });
 }
 
 // Compute particle kinematics
@@ -199,27 +257,39 @@ inline void mpm::MPMScheme<Tdim>::compute_particle_kinematics(
 
   // Check if damping has been specified and accordingly Iterate over
   // active nodes to compute acceleratation and velocity
+  const double dt = dt_;
   if (damping_type == "Cundall")
     mesh_->iterate_over_nodes_predicate(
-        std::bind(&mpm::NodeBase<Tdim>::compute_acceleration_velocity_cundall,
-                  std::placeholders::_1, phase, dt_, damping_factor),
-        std::bind(&mpm::NodeBase<Tdim>::status, std::placeholders::_1));
+        [phase, dt, damping_factor](
+            const std::shared_ptr<mpm::NodeBase<Tdim>>& node) {
+          node->compute_acceleration_velocity_cundall(phase, dt,
+                                                      damping_factor);
+        },
+        [](const std::shared_ptr<mpm::NodeBase<Tdim>>& node) {
+          return node->status();
+        });
   else
     mesh_->iterate_over_nodes_predicate(
-        std::bind(&mpm::NodeBase<Tdim>::compute_acceleration_velocity,
-                  std::placeholders::_1, phase, dt_),
-        std::bind(&mpm::NodeBase<Tdim>::status, std::placeholders::_1));
+        [phase, dt](const std::shared_ptr<mpm::NodeBase<Tdim>>& node) {
+          node->compute_acceleration_velocity(phase, dt);
+        },
+        [](const std::shared_ptr<mpm::NodeBase<Tdim>>& node) {
+          return node->status();
+        });
 
   // Iterate over each particle to compute updated position
   mesh_->iterate_over_particles(
-      std::bind(&mpm::ParticleBase<Tdim>::compute_updated_position,
-                std::placeholders::_1, dt_, velocity_update));
+      [dt, velocity_update](
+          const std::shared_ptr<mpm::ParticleBase<Tdim>>& particle) {
+        particle->compute_updated_position(dt, velocity_update);
+      });
 
   // Iterate over each particle to update deformation gradient
   if (update_defgrad)
     mesh_->iterate_over_particles(
-        std::bind(&mpm::ParticleBase<Tdim>::update_deformation_gradient,
-                  std::placeholders::_1, "velocity", dt_));
+        [dt](const std::shared_ptr<mpm::ParticleBase<Tdim>>& particle) {
+          particle->update_deformation_gradient("velocity", dt);
+        });
 
   // Apply particle velocity constraints
   mesh_->apply_particle_velocity_constraints();
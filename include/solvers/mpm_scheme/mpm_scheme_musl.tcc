@@ -22,14 +22,20 @@ inline void mpm::MPMSchemeMUSL<Tdim>::postcompute_nodal_kinematics(
     unsigned phase) {
   // Assign mass and momentum to nodes zero
   mesh_->iterate_over_nodes_predicate(
-      std::bind(&mpm::NodeBase<Tdim>::update_mass, std::placeholders::_1, false,
-                phase, 0.0),
-      std::bind(&mpm::NodeBase<Tdim>::status, std::placeholders::_1));
+      [phase](const std::shared_ptr<mpm::NodeBase<Tdim>>& node) {
+        node->update_mass(false, phase, 0.0);
+      },
+      [](const std::shared_ptr<mpm::NodeBase<Tdim>>& node) {
+        return node->status();
+      });
 
   mesh_->iterate_over_nodes_predicate(
-      std::bind(&mpm::NodeBase<Tdim>::update_momentum, std::placeholders::_1,
-                false, phase, VectorDim::Zero()),
-      std::bind(&mpm::NodeBase<Tdim>::status, std::placeholders::_1));
+      [phase](const std::shared_ptr<mpm::NodeBase<Tdim>>& node) {
+        node->update_momentum(false, phase, VectorDim::Zero());
+      },
+      [](const std::shared_ptr<mpm::NodeBase<Tdim>>& node) {
+        return node->status();
+      });
 
   this->compute_nodal_kinematics(phase);
 }
@@ -87,8 +87,10 @@ bool mpm::MPMSemiImplicitNavierStokes<Tdim>::solve() {
     this->initialise_particles();
 
     // Compute mass for single phase fluid
-    mesh_->iterate_over_particles(std::bind(
-        &mpm::ParticleBase<Tdim>::compute_mass, std::placeholders::_1));
+    mesh_->iterate_over_particles(
+        [](const std::shared_ptr<mpm::ParticleBase<Tdim>>& particle) {
+          particle->compute_mass();
+        });
 
     // Domain decompose
     this->mpi_domain_decompose(initial_step);
@@ -119,8 +121,10 @@ bool mpm::MPMSemiImplicitNavierStokes<Tdim>::solve() {
 
 #ifdef USE_MPI
 #ifdef USE_GRAPH_PARTITIONING
-    // Run load balancer at a specified frequency
-    if (step_ % nload_balance_steps_ == 0 && step_ != 0)
+    // Run load balancer at a specified frequency, skipping the costly
+    // repartition while particle counts remain balanced across ranks
+    if (step_ % nload_balance_steps_ == 0 && step_ != 0 &&
+        this->mpi_load_imbalanced())
       this->mpi_domain_decompose(false);
 #endif
 #endif
@@ -317,10 +321,16 @@ bool mpm::MPMSemiImplicitNavierStokes<Tdim>::solve() {
       for (const auto& remove_particle : unlocatable_particles)
         mesh_->remove_particle(remove_particle);
 
+    // Periodically restore spatial locality of the particle container
+    if (step_ % nload_balance_steps_ == 0 && step_ != 0)
+      mesh_->sort_particles_by_cell();
+
 #ifdef USE_MPI
 #ifdef USE_GRAPH_PARTITIONING
+    // The halo exchange completes pairwise (matched sends/receives plus
+    // MPI_Wait on the send requests), so no global barrier is needed and
+    // ranks proceed to output as soon as their own transfers finish
     mesh_->transfer_halo_particles();
-    MPI_Barrier(MPI_COMM_WORLD);
 #endif
 #endif
 
@@ -513,11 +523,8 @@ template <unsigned Tdim>
 bool mpm::MPMSemiImplicitNavierStokes<Tdim>::compute_correction_force() {
   bool status = true;
   try {
-    // Map correction matrix from particles to cell
-    mesh_->iterate_over_particles(
-        std::bind(&mpm::ParticleBase<Tdim>::map_correction_matrix_to_cell,
-                  std::placeholders::_1));
-
+    // The local correction matrices were already accumulated in the fused
+    // particle sweep of compute_poisson_equation, so only assembly remains
     // Assemble correction matrix
     assembler_->assemble_corrector_right(dt_);
 
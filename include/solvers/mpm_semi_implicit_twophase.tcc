@@ -117,8 +117,10 @@ bool mpm::MPMSemiImplicitTwoPhase<Tdim>::solve() {
         &mpm::ParticleBase<Tdim>::assign_permeability, std::placeholders::_1));
 
     // Compute mass for each phase
-    mesh_->iterate_over_particles(std::bind(
-        &mpm::ParticleBase<Tdim>::compute_mass, std::placeholders::_1));
+    mesh_->iterate_over_particles(
+        [](const std::shared_ptr<mpm::ParticleBase<Tdim>>& particle) {
+          particle->compute_mass();
+        });
 
     // Domain decompose
     this->mpi_domain_decompose(initial_step);
@@ -149,8 +151,10 @@ bool mpm::MPMSemiImplicitTwoPhase<Tdim>::solve() {
 
 #ifdef USE_MPI
 #ifdef USE_GRAPH_PARTITIONING
-    // Run load balancer at a specified frequency
-    if (step_ % nload_balance_steps_ == 0 && step_ != 0)
+    // Run load balancer at a specified frequency, skipping the costly
+    // repartition while particle counts remain balanced across ranks
+    if (step_ % nload_balance_steps_ == 0 && step_ != 0 &&
+        this->mpi_load_imbalanced())
       this->mpi_domain_decompose(false);
 #endif
 #endif
@@ -384,10 +388,16 @@ bool mpm::MPMSemiImplicitTwoPhase<Tdim>::solve() {
       for (const auto& remove_particle : unlocatable_particles)
         mesh_->remove_particle(remove_particle);
 
+    // Periodically restore spatial locality of the particle container
+    if (step_ % nload_balance_steps_ == 0 && step_ != 0)
+      mesh_->sort_particles_by_cell();
+
 #ifdef USE_MPI
 #ifdef USE_GRAPH_PARTITIONING
+    // The halo exchange completes pairwise (matched sends/receives plus
+    // MPI_Wait on the send requests), so no global barrier is needed and
+    // ranks proceed to output as soon as their own transfers finish
     mesh_->transfer_halo_particles();
-    MPI_Barrier(MPI_COMM_WORLD);
 #endif
 #endif
 
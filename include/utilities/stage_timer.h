@@ -0,0 +1,74 @@
+#ifndef MPM_STAGE_TIMER_H_
+#define MPM_STAGE_TIMER_H_
+
+#include <chrono>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "spdlog/spdlog.h"
+
+namespace mpm {
+
+//! \brief Accumulate per-stage wall-clock durations over the solver loop
+//! \details Every member compiles to an empty inline function unless the
+//! build defines MPM_PROFILE, so release builds carry no instrumentation
+class StageTimer {
+ public:
+#ifdef MPM_PROFILE
+  //! Mark the beginning of a stage
+  inline void start() { begin_ = std::chrono::steady_clock::now(); }
+
+  //! Accumulate the time since start() against a named stage
+  //! \param[in] stage Stage name used in the report
+  inline void lap(const char* stage) {
+    const auto now = std::chrono::steady_clock::now();
+    for (auto& entry : stages_)
+      if (entry.first == stage) {
+        entry.second += now - begin_;
+        begin_ = now;
+        return;
+      }
+    stages_.emplace_back(stage, now - begin_);
+    begin_ = now;
+  }
+
+  //! Log the accumulated duration and share of each stage
+  //! \param[in] console Logger used for the report
+  inline void report(const std::shared_ptr<spdlog::logger>& console) const {
+    std::chrono::steady_clock::duration total{0};
+    for (const auto& entry : stages_) total += entry.second;
+    for (const auto& entry : stages_) {
+      const double duration =
+          std::chrono::duration_cast<std::chrono::duration<double, std::milli>>(
+              entry.second)
+              .count();
+      const double share =
+          total.count() > 0
+              ? 100. * static_cast<double>(entry.second.count()) /
+                    static_cast<double>(total.count())
+              : 0.;
+      console->info("Stage {}: {:.3f} ms ({:.1f} %)", entry.first, duration,
+                    share);
+    }
+  }
+#else
+  inline void start() {}
+  inline void lap(const char*) {}
+  inline void report(const std::shared_ptr<spdlog::logger>&) const {}
+#endif
+
+ private:
+#ifdef MPM_PROFILE
+  //! Start time of the current stage
+  std::chrono::steady_clock::time_point begin_;
+  //! Accumulated duration per stage, in first-use order
+  std::vector<std::pair<std::string, std::chrono::steady_clock::duration>>
+      stages_;
+#endif
+};
+
+}  // namespace mpm
+
+#endif  // MPM_STAGE_TIMER_H_
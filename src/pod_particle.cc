@@ -1,229 +1,192 @@
+#include <algorithm>
+#include <cstring>
+
 #include "pod_particle.h"
 namespace mpm {
 namespace pod {
 namespace particle {
+// Single list of PODParticle fields keeping name, offset, size and HDF5
+// type in one place; the parallel descriptor arrays below are generated
+// from it so they cannot drift apart. F expands a scalar member, S a
+// state-variable slot.
+// clang-format off
+#define POD_PARTICLE_FIELDS(F, S) \
+  F(id, H5T_NATIVE_LLONG) \
+  F(mass, H5T_NATIVE_DOUBLE) \
+  F(volume, H5T_NATIVE_DOUBLE) \
+  F(pressure, H5T_NATIVE_DOUBLE) \
+  F(coord_x, H5T_NATIVE_DOUBLE) \
+  F(coord_y, H5T_NATIVE_DOUBLE) \
+  F(coord_z, H5T_NATIVE_DOUBLE) \
+  F(displacement_x, H5T_NATIVE_DOUBLE) \
+  F(displacement_y, H5T_NATIVE_DOUBLE) \
+  F(displacement_z, H5T_NATIVE_DOUBLE) \
+  F(nsize_x, H5T_NATIVE_DOUBLE) \
+  F(nsize_y, H5T_NATIVE_DOUBLE) \
+  F(nsize_z, H5T_NATIVE_DOUBLE) \
+  F(velocity_x, H5T_NATIVE_DOUBLE) \
+  F(velocity_y, H5T_NATIVE_DOUBLE) \
+  F(velocity_z, H5T_NATIVE_DOUBLE) \
+  F(acceleration_x, H5T_NATIVE_DOUBLE) \
+  F(acceleration_y, H5T_NATIVE_DOUBLE) \
+  F(acceleration_z, H5T_NATIVE_DOUBLE) \
+  F(stress_xx, H5T_NATIVE_DOUBLE) \
+  F(stress_yy, H5T_NATIVE_DOUBLE) \
+  F(stress_zz, H5T_NATIVE_DOUBLE) \
+  F(tau_xy, H5T_NATIVE_DOUBLE) \
+  F(tau_yz, H5T_NATIVE_DOUBLE) \
+  F(tau_xz, H5T_NATIVE_DOUBLE) \
+  F(strain_xx, H5T_NATIVE_DOUBLE) \
+  F(strain_yy, H5T_NATIVE_DOUBLE) \
+  F(strain_zz, H5T_NATIVE_DOUBLE) \
+  F(gamma_xy, H5T_NATIVE_DOUBLE) \
+  F(gamma_yz, H5T_NATIVE_DOUBLE) \
+  F(gamma_xz, H5T_NATIVE_DOUBLE) \
+  F(defgrad_00, H5T_NATIVE_DOUBLE) \
+  F(defgrad_01, H5T_NATIVE_DOUBLE) \
+  F(defgrad_02, H5T_NATIVE_DOUBLE) \
+  F(defgrad_10, H5T_NATIVE_DOUBLE) \
+  F(defgrad_11, H5T_NATIVE_DOUBLE) \
+  F(defgrad_12, H5T_NATIVE_DOUBLE) \
+  F(defgrad_20, H5T_NATIVE_DOUBLE) \
+  F(defgrad_21, H5T_NATIVE_DOUBLE) \
+  F(defgrad_22, H5T_NATIVE_DOUBLE) \
+  F(status, H5T_NATIVE_HBOOL) \
+  F(cell_id, H5T_NATIVE_LLONG) \
+  F(material_id, H5T_NATIVE_UINT) \
+  F(nstate_vars, H5T_NATIVE_UINT) \
+  S(0) \
+  S(1) \
+  S(2) \
+  S(3) \
+  S(4) \
+  S(5) \
+  S(6) \
+  S(7) \
+  S(8) \
+  S(9) \
+  S(10) \
+  S(11) \
+  S(12) \
+  S(13) \
+  S(14) \
+  S(15) \
+  S(16) \
+  S(17) \
+  S(18) \
+  S(19)
+// clang-format on
+
 const size_t dst_offset[NFIELDS] = {
-    HOFFSET(PODParticle, id),
-    HOFFSET(PODParticle, mass),
-    HOFFSET(PODParticle, volume),
-    HOFFSET(PODParticle, pressure),
-    HOFFSET(PODParticle, coord_x),
-    HOFFSET(PODParticle, coord_y),
-    HOFFSET(PODParticle, coord_z),
-    HOFFSET(PODParticle, displacement_x),
-    HOFFSET(PODParticle, displacement_y),
-    HOFFSET(PODParticle, displacement_z),
-    HOFFSET(PODParticle, nsize_x),
-    HOFFSET(PODParticle, nsize_y),
-    HOFFSET(PODParticle, nsize_z),
-    HOFFSET(PODParticle, velocity_x),
-    HOFFSET(PODParticle, velocity_y),
-    HOFFSET(PODParticle, velocity_z),
-    HOFFSET(PODParticle, acceleration_x),
-    HOFFSET(PODParticle, acceleration_y),
-    HOFFSET(PODParticle, acceleration_z),
-    HOFFSET(PODParticle, stress_xx),
-    HOFFSET(PODParticle, stress_yy),
-    HOFFSET(PODParticle, stress_zz),
-    HOFFSET(PODParticle, tau_xy),
-    HOFFSET(PODParticle, tau_yz),
-    HOFFSET(PODParticle, tau_xz),
-    HOFFSET(PODParticle, strain_xx),
-    HOFFSET(PODParticle, strain_yy),
-    HOFFSET(PODParticle, strain_zz),
-    HOFFSET(PODParticle, gamma_xy),
-    HOFFSET(PODParticle, gamma_yz),
-    HOFFSET(PODParticle, gamma_xz),
-    HOFFSET(PODParticle, defgrad_00),
-    HOFFSET(PODParticle, defgrad_01),
-    HOFFSET(PODParticle, defgrad_02),
-    HOFFSET(PODParticle, defgrad_10),
-    HOFFSET(PODParticle, defgrad_11),
-    HOFFSET(PODParticle, defgrad_12),
-    HOFFSET(PODParticle, defgrad_20),
-    HOFFSET(PODParticle, defgrad_21),
-    HOFFSET(PODParticle, defgrad_22),
-    HOFFSET(PODParticle, status),
-    HOFFSET(PODParticle, cell_id),
-    HOFFSET(PODParticle, material_id),
-    HOFFSET(PODParticle, nstate_vars),
-    HOFFSET(PODParticle, svars[0]),
-    HOFFSET(PODParticle, svars[1]),
-    HOFFSET(PODParticle, svars[2]),
-    HOFFSET(PODParticle, svars[3]),
-    HOFFSET(PODParticle, svars[4]),
-    HOFFSET(PODParticle, svars[5]),
-    HOFFSET(PODParticle, svars[6]),
-    HOFFSET(PODParticle, svars[7]),
-    HOFFSET(PODParticle, svars[8]),
-    HOFFSET(PODParticle, svars[9]),
-    HOFFSET(PODParticle, svars[10]),
-    HOFFSET(PODParticle, svars[11]),
-    HOFFSET(PODParticle, svars[12]),
-    HOFFSET(PODParticle, svars[13]),
-    HOFFSET(PODParticle, svars[14]),
-    HOFFSET(PODParticle, svars[15]),
-    HOFFSET(PODParticle, svars[16]),
-    HOFFSET(PODParticle, svars[17]),
-    HOFFSET(PODParticle, svars[18]),
-    HOFFSET(PODParticle, svars[19]),
+#define POD_FIELD_OFFSET(field, h5type) HOFFSET(PODParticle, field),
+#define POD_SVAR_OFFSET(i) HOFFSET(PODParticle, svars[i]),
+    POD_PARTICLE_FIELDS(POD_FIELD_OFFSET, POD_SVAR_OFFSET)
+#undef POD_FIELD_OFFSET
+#undef POD_SVAR_OFFSET
 };
 
-// Get size of particle
-PODParticle particle;
 const size_t dst_sizes[NFIELDS] = {
-    sizeof(particle.id),
-    sizeof(particle.mass),
-    sizeof(particle.volume),
-    sizeof(particle.pressure),
-    sizeof(particle.coord_x),
-    sizeof(particle.coord_y),
-    sizeof(particle.coord_z),
-    sizeof(particle.displacement_x),
-    sizeof(particle.displacement_y),
-    sizeof(particle.displacement_z),
-    sizeof(particle.nsize_x),
-    sizeof(particle.nsize_y),
-    sizeof(particle.nsize_z),
-    sizeof(particle.velocity_x),
-    sizeof(particle.velocity_y),
-    sizeof(particle.velocity_z),
-    sizeof(particle.acceleration_x),
-    sizeof(particle.acceleration_y),
-    sizeof(particle.acceleration_z),
-    sizeof(particle.stress_xx),
-    sizeof(particle.stress_yy),
-    sizeof(particle.stress_zz),
-    sizeof(particle.tau_xy),
-    sizeof(particle.tau_yz),
-    sizeof(particle.tau_xz),
-    sizeof(particle.strain_xx),
-    sizeof(particle.strain_yy),
-    sizeof(particle.strain_zz),
-    sizeof(particle.gamma_xy),
-    sizeof(particle.gamma_yz),
-    sizeof(particle.gamma_xz),
-    sizeof(particle.defgrad_00),
-    sizeof(particle.defgrad_01),
-    sizeof(particle.defgrad_02),
-    sizeof(particle.defgrad_10),
-    sizeof(particle.defgrad_11),
-    sizeof(particle.defgrad_12),
-    sizeof(particle.defgrad_20),
-    sizeof(particle.defgrad_21),
-    sizeof(particle.defgrad_22),
-    sizeof(particle.status),
-    sizeof(particle.cell_id),
-    sizeof(particle.material_id),
-    sizeof(particle.nstate_vars),
-    sizeof(particle.svars[0]),
-    sizeof(particle.svars[1]),
-    sizeof(particle.svars[2]),
-    sizeof(particle.svars[3]),
-    sizeof(particle.svars[4]),
-    sizeof(particle.svars[5]),
-    sizeof(particle.svars[6]),
-    sizeof(particle.svars[7]),
-    sizeof(particle.svars[8]),
-    sizeof(particle.svars[9]),
-    sizeof(particle.svars[10]),
-    sizeof(particle.svars[11]),
-    sizeof(particle.svars[12]),
-    sizeof(particle.svars[13]),
-    sizeof(particle.svars[14]),
-    sizeof(particle.svars[15]),
-    sizeof(particle.svars[16]),
-    sizeof(particle.svars[17]),
-    sizeof(particle.svars[18]),
-    sizeof(particle.svars[19]),
+#define POD_FIELD_SIZE(field, h5type) sizeof(PODParticle::field),
+#define POD_SVAR_SIZE(i) sizeof(double),
+    POD_PARTICLE_FIELDS(POD_FIELD_SIZE, POD_SVAR_SIZE)
+#undef POD_FIELD_SIZE
+#undef POD_SVAR_SIZE
 };
 
 // Define particle field information
 const char* field_names[NFIELDS] = {
-    "id",
-    "mass",
-    "volume",
-    "pressure",
-    "coord_x",
-    "coord_y",
-    "coord_z",
-    "displacement_x",
-    "displacement_y",
-    "displacement_z",
-    "nsize_x",
-    "nsize_y",
-    "nsize_z",
-    "velocity_x",
-    "velocity_y",
-    "velocity_z",
-    "acceleration_x",
-    "acceleration_y",
-    "acceleration_z",
-    "stress_xx",
-    "stress_yy",
-    "stress_zz",
-    "tau_xy",
-    "tau_yz",
-    "tau_xz",
-    "strain_xx",
-    "strain_yy",
-    "strain_zz",
-    "gamma_xy",
-    "gamma_yz",
-    "gamma_xz",
-    "defgrad_00",
-    "defgrad_01",
-    "defgrad_02",
-    "defgrad_10",
-    "defgrad_11",
-    "defgrad_12",
-    "defgrad_20",
-    "defgrad_21",
-    "defgrad_22",
-    "status",
-    "cell_id",
-    "material_id",
-    "nstate_vars",
-    "svars_0",
-    "svars_1",
-    "svars_2",
-    "svars_3",
-    "svars_4",
-    "svars_5",
-    "svars_6",
-    "svars_7",
-    "svars_8",
-    "svars_9",
-    "svars_10",
-    "svars_11",
-    "svars_12",
-    "svars_13",
-    "svars_14",
-    "svars_15",
-    "svars_16",
-    "svars_17",
-    "svars_18",
-    "svars_19",
+#define POD_FIELD_NAME(field, h5type) #field,
+#define POD_SVAR_NAME(i) "svars_" #i,
+    POD_PARTICLE_FIELDS(POD_FIELD_NAME, POD_SVAR_NAME)
+#undef POD_FIELD_NAME
+#undef POD_SVAR_NAME
 };
 
 // Initialize field types
 const hid_t field_type[NFIELDS] = {
-    H5T_NATIVE_LLONG,  H5T_NATIVE_DOUBLE, H5T_NATIVE_DOUBLE, H5T_NATIVE_DOUBLE,
-    H5T_NATIVE_DOUBLE, H5T_NATIVE_DOUBLE, H5T_NATIVE_DOUBLE, H5T_NATIVE_DOUBLE,
-    H5T_NATIVE_DOUBLE, H5T_NATIVE_DOUBLE, H5T_NATIVE_DOUBLE, H5T_NATIVE_DOUBLE,
-    H5T_NATIVE_DOUBLE, H5T_NATIVE_DOUBLE, H5T_NATIVE_DOUBLE, H5T_NATIVE_DOUBLE,
-    H5T_NATIVE_DOUBLE, H5T_NATIVE_DOUBLE, H5T_NATIVE_DOUBLE, H5T_NATIVE_DOUBLE,
-    H5T_NATIVE_DOUBLE, H5T_NATIVE_DOUBLE, H5T_NATIVE_DOUBLE, H5T_NATIVE_DOUBLE,
-    H5T_NATIVE_DOUBLE, H5T_NATIVE_DOUBLE, H5T_NATIVE_DOUBLE, H5T_NATIVE_DOUBLE,
-    H5T_NATIVE_DOUBLE, H5T_NATIVE_DOUBLE, H5T_NATIVE_DOUBLE, H5T_NATIVE_DOUBLE,
-    H5T_NATIVE_DOUBLE, H5T_NATIVE_DOUBLE, H5T_NATIVE_DOUBLE, H5T_NATIVE_DOUBLE,
-    H5T_NATIVE_DOUBLE, H5T_NATIVE_DOUBLE, H5T_NATIVE_DOUBLE, H5T_NATIVE_DOUBLE,
-    H5T_NATIVE_HBOOL,  H5T_NATIVE_LLONG,  H5T_NATIVE_UINT,   H5T_NATIVE_UINT,
-    H5T_NATIVE_DOUBLE, H5T_NATIVE_DOUBLE, H5T_NATIVE_DOUBLE, H5T_NATIVE_DOUBLE,
-    H5T_NATIVE_DOUBLE, H5T_NATIVE_DOUBLE, H5T_NATIVE_DOUBLE, H5T_NATIVE_DOUBLE,
-    H5T_NATIVE_DOUBLE, H5T_NATIVE_DOUBLE, H5T_NATIVE_DOUBLE, H5T_NATIVE_DOUBLE,
-    H5T_NATIVE_DOUBLE, H5T_NATIVE_DOUBLE, H5T_NATIVE_DOUBLE, H5T_NATIVE_DOUBLE,
-    H5T_NATIVE_DOUBLE, H5T_NATIVE_DOUBLE, H5T_NATIVE_DOUBLE, H5T_NATIVE_DOUBLE};
+#define POD_FIELD_TYPE(field, h5type) h5type,
+#define POD_SVAR_TYPE(i) H5T_NATIVE_DOUBLE,
+    POD_PARTICLE_FIELDS(POD_FIELD_TYPE, POD_SVAR_TYPE)
+#undef POD_FIELD_TYPE
+#undef POD_SVAR_TYPE
+};
+
+#undef POD_PARTICLE_FIELDS
+
+//! Write particles to an HDF5 file with one dataset per field
+void write_particles(const std::string& filename,
+                     const std::vector<PODParticle>& particle_data) {
+  // Scalar fields; the trailing state variables are written as one
+  // two-dimensional dataset instead of NSVARS scalar columns
+  const hsize_t nscalar_fields =
+      mpm::pod::particle::NFIELDS - mpm::pod::particle::NSVARS;
+  const hsize_t nrecords = particle_data.size();
+
+  // Create a new file using default properties.
+  hid_t file_id =
+      H5Fcreate(filename.c_str(), H5F_ACC_TRUNC, H5P_DEFAULT, H5P_DEFAULT);
+
+  // Chunked storage with a byte-shuffle + deflate pipeline; checkpoint
+  // writes are bandwidth bound and particle columns are low entropy
+  const hsize_t chunk = std::min<hsize_t>(std::max<hsize_t>(nrecords, 1),
+                                          static_cast<hsize_t>(16384));
+
+  // Write each field as its own contiguous one-dimensional dataset, so
+  // readers of a subset of fields only move those bytes
+  const char* base = reinterpret_cast<const char*>(particle_data.data());
+  std::vector<char> column;
+  for (hsize_t field = 0; field < nscalar_fields; ++field) {
+    const size_t size = mpm::pod::particle::dst_sizes[field];
+    const size_t offset = mpm::pod::particle::dst_offset[field];
+    // Gather the column from the particle records
+    column.resize(size * nrecords);
+    for (hsize_t i = 0; i < nrecords; ++i)
+      std::memcpy(&column[i * size], base + i * sizeof(PODParticle) + offset,
+                  size);
+
+    hid_t space_id = H5Screate_simple(1, &nrecords, nullptr);
+    hid_t dcpl_id = H5Pcreate(H5P_DATASET_CREATE);
+    H5Pset_chunk(dcpl_id, 1, &chunk);
+    H5Pset_shuffle(dcpl_id);
+    H5Pset_deflate(dcpl_id, 4);
+    hid_t dataset_id = H5Dcreate2(
+        file_id, mpm::pod::particle::field_names[field],
+        mpm::pod::particle::field_type[field], space_id, H5P_DEFAULT, dcpl_id,
+        H5P_DEFAULT);
+    H5Dwrite(dataset_id, mpm::pod::particle::field_type[field], H5S_ALL,
+             H5S_ALL, H5P_DEFAULT, column.data());
+    H5Dclose(dataset_id);
+    H5Pclose(dcpl_id);
+    H5Sclose(space_id);
+  }
+
+  // State variables as a single [nrecords][NSVARS] dataset
+  {
+    const size_t offset = mpm::pod::particle::dst_offset[nscalar_fields];
+    const size_t row_size = sizeof(double) * mpm::pod::particle::NSVARS;
+    column.resize(row_size * nrecords);
+    for (hsize_t i = 0; i < nrecords; ++i)
+      std::memcpy(&column[i * row_size],
+                  base + i * sizeof(PODParticle) + offset, row_size);
+
+    hsize_t dims[2] = {nrecords, mpm::pod::particle::NSVARS};
+    hsize_t chunk_dims[2] = {chunk, mpm::pod::particle::NSVARS};
+    hid_t space_id = H5Screate_simple(2, dims, nullptr);
+    hid_t dcpl_id = H5Pcreate(H5P_DATASET_CREATE);
+    H5Pset_chunk(dcpl_id, 2, chunk_dims);
+    H5Pset_shuffle(dcpl_id);
+    H5Pset_deflate(dcpl_id, 4);
+    hid_t dataset_id = H5Dcreate2(file_id, "svars", H5T_NATIVE_DOUBLE,
+                                  space_id, H5P_DEFAULT, dcpl_id, H5P_DEFAULT);
+    H5Dwrite(dataset_id, H5T_NATIVE_DOUBLE, H5S_ALL, H5S_ALL, H5P_DEFAULT,
+             column.data());
+    H5Dclose(dataset_id);
+    H5Pclose(dcpl_id);
+    H5Sclose(space_id);
+  }
+
+  H5Fclose(file_id);
+}
 }  // namespace particle
 }  // namespace pod
 }  // namespace mpm
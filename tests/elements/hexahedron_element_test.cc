@@ -2106,140 +2106,140 @@ TEST_CASE("Hexahedron elements are checked", "[hex][element][3D]") {
       REQUIRE(laplace_matrix.cols() == nfunctions);
 
       Eigen::Matrix<double, 20, 20> laplace;
-      laplace << 6.15933929330602, 4.938676360208379, 4.058798842761456,
-          3.776996153514026, 4.976923615044938, 4.348568809939851,
-          3.907765270436546, 5.794922003041152, -2.378685014427916,
-          -5.536048018007822, -8.84093622113221, -1.100857511792741,
-          -5.522691796058115, 0.01790980108445428, -6.030343075250605,
-          -14.68581000074875, -1.224340104438079, -0.005114463255402324,
-          -2.234642701444805, -1.356471975117627, 4.938676360208379,
-          11.21484802784489, 4.081716008429723, 3.42897599003046,
-          5.025879299946409, 8.170918200545696, 4.95877517199694,
-          7.782823613402732, -2.858753754386522, -3.612270433156081,
-          -7.501753263993352, 2.264122966861815, -12.42024109318314,
-          -2.014924579198793, -6.892202977180818, -7.611220041618338,
-          -3.049877388674338, -0.06047605860149874, -4.571120776660473,
-          -1.65973684528307, 4.058798842761456, 4.081716008429723,
-          8.528392031420996, 4.523672525376581, 0.6731108109138284,
-          4.001455589844431, 4.158805328105587, 5.922297826135225,
-          -3.128651652280993, -5.056094482013514, -3.383579335130428,
-          -3.449854529765026, -4.509018906055925, -6.611884017194679,
-          -9.161348600196341, -11.07427442942752, 1.994885866560606,
-          5.019500172357599, -1.507880835141334, 0.2231785103095052,
-          3.776996153514026, 3.42897599003046, 4.523672525376581,
-          5.659178156732192, 2.059164452549481, 4.760061473171758,
-          3.323047914967523, 4.366168456560783, -2.87529736009937,
-          -4.150936493636122, -4.089638778195734, -4.496272990998748,
-          -3.34471447300587, -1.105338197190417, -5.574589174004736,
-          -8.273216409082542, 2.850808750123276, -0.4187973830786254,
-          -1.62047095951107, -1.289711081566152, 4.976923615044938,
-          5.025879299946409, 0.6731108109138284, 2.059164452549481,
-          7.596193475939065, 4.5620913238822, 3.835574427742611,
-          4.393331161268728, -1.092981827654348, -3.343689344221354,
-          -9.630640335753997, 2.429841121276548, -6.215116692494317,
-          6.644839781301256, -3.223741811124502, -10.90764512285358,
-          -4.114786139361408, -5.749284093800984, -3.564920648690664,
-          -3.832477684274747, 4.348568809939851, 8.170918200545696,
-          4.001455589844431, 4.760061473171758, 4.5620913238822,
-          10.27495321916873, 5.094648956715952, 7.432212216606898,
-          -2.486249474018963, -2.437380936216606, -6.718037799849757,
-          -0.2648377020835075, -11.32726336676532, 1.262993685950383,
-          -6.298130156830595, -6.311463206932629, -0.1224764752776564,
-          -3.137369670859187, -5.428028023658495, -3.368706027054427,
-          3.907765270436546, 4.95877517199694, 4.158805328105587,
-          3.323047914967523, 3.835574427742611, 5.094648956715952,
-          4.868117032930769, 5.376372541761476, -1.727190081128829,
-          -3.45683439863675, -5.605169446019096, -0.2591007294201401,
-          -6.196235967511092, 0.8700445595441595, -6.693580082984033,
-          -9.973298940902511, -1.228546058258308, -1.778473873127997,
-          -2.863588535286143, -2.306783229826141, 5.794922003041152,
-          7.782823613402732, 5.922297826135225, 4.366168456560783,
-          4.393331161268728, 7.432212216606898, 5.376372541761476,
-          8.921045899194265, -2.387907021436512, -5.390523498842208,
-          -7.820615208588086, -0.1830238819466619, -9.026098123982962,
-          -3.124740398165035, -8.267048789751669, -13.99740974932118,
-          -1.311995151763001, 1.03924667861088, -4.282897589581626,
-          -1.802131403274742, -2.378685014427916, -2.858753754386522,
-          -3.128651652280993, -2.87529736009937, -1.092981827654348,
-          -2.486249474018963, -1.727190081128829, -2.387907021436512,
-          3.478537433168269, 3.162486654381813, 1.929362069412624,
-          2.554816111258024, 2.450802325183254, 2.005097580329037,
-          3.077233484452764, 5.289675192086496, -1.306252274523052,
-          -1.924540455797193, 0.8089307276172231, 0.1745311932139862,
-          -5.536048018007822, -3.612270433156081, -5.056094482013514,
-          -4.150936493636122, -3.343689344221354, -2.437380936216606,
-          -3.45683439863675, -5.390523498842208, 3.162486654381813,
-          7.694270889376506, 6.325116353879784, 2.795579123304787,
-          2.805784366472655, 2.094313819397243, 6.266075584923926,
-          16.85227124419685, -0.3218247904602536, -2.325448469162336,
-          1.216345925982085, 0.3342907581563925, -8.84093622113221,
-          -7.501753263993352, -3.383579335130428, -4.089638778195734,
-          -9.630640335753997, -6.718037799849757, -5.605169446019096,
-          -7.820615208588086, 1.929362069412624, 6.325116353879784,
-          16.65481772392231, -1.52751034833257, 9.56845082209581,
-          -4.97377468321884, 7.715613883285052, 20.62390415224664,
-          3.85201132461631, 3.008046123097777, 3.771832424523221,
-          3.072975093350886, -1.100857511792741, 2.264122966861815,
-          -3.449854529765026, -4.496272990998748, 2.429841121276548,
-          -0.2648377020835075, -0.2591007294201401, -0.1830238819466619,
-          2.554816111258024, 2.795579123304787, -1.52751034833257,
-          8.309579819087396, -3.434090554679442, 4.008645820931794,
-          2.207691804916842, 3.532193269393903, -6.355249485048906,
-          -3.10295257534748, -1.764661695165005, -1.48764845435588,
-          -5.522691796058115, -12.42024109318314, -4.509018906055925,
-          -3.34471447300587, -6.215116692494317, -11.32726336676532,
-          -6.196235967511092, -9.026098123982962, 2.450802325183254,
-          2.805784366472655, 9.56845082209581, -3.434090554679442,
-          17.31995670162867, -0.08715670847230617, 8.583409530767243,
-          8.191938770150042, 2.639743911640359, 1.425972706741691,
-          6.068607056478453, 2.618649377999702, 0.01790980108445428,
-          -2.014924579198793, -6.611884017194679, -1.105338197190417,
-          6.644839781301256, 1.262993685950383, 0.8700445595441595,
-          -3.124740398165035, 2.005097580329037, 2.094313819397243,
-          -4.97377468321884, 4.008645820931794, -0.08715670847230617,
-          21.60969173425412, 3.78272085197206, -1.306125286215504,
-          -3.983060122830408, -16.57598866067371, -2.703454821116731,
-          -6.994707556124125, -6.030343075250605, -6.892202977180818,
-          -9.161348600196341, -5.574589174004736, -3.223741811124502,
-          -6.298130156830595, -6.693580082984033, -8.267048789751669,
-          3.077233484452764, 6.266075584923926, 7.715613883285052,
-          2.207691804916842, 8.583409530767243, 3.78272085197206,
-          14.76681367477093, 17.55516221554868, -1.044520834401446,
-          -3.276239931573811, 1.824319371886537, 0.4318785484492591,
-          -14.68581000074875, -7.611220041618338, -11.07427442942752,
-          -8.273216409082542, -10.90764512285358, -6.311463206932629,
-          -9.973298940902511, -13.99740974932118, 5.289675192086496,
-          16.85227124419685, 20.62390415224664, 3.532193269393903,
-          8.191938770150042, -1.306125286215504, 17.55516221554868,
-          48.97962793203256, 2.464278846470994, -1.995148786476195,
-          3.552023642690095, 2.608844340193837, -1.224340104438079,
-          -3.049877388674338, 1.994885866560606, 2.850808750123276,
-          -4.114786139361408, -0.1224764752776564, -1.228546058258308,
-          -1.311995151763001, -1.306252274523052, -0.3218247904602536,
-          3.85201132461631, -6.355249485048906, 2.639743911640359,
-          -3.983060122830408, -1.044520834401446, 2.464278846470994,
-          7.986302123593876, 3.502372446512387, 2.127198741799675,
-          2.142680789218174, -0.005114463255402324, -0.06047605860149874,
-          5.019500172357599, -0.4187973830786254, -5.749284093800984,
-          -3.137369670859187, -1.778473873127997, 1.03924667861088,
-          -1.924540455797193, -2.325448469162336, 3.008046123097777,
-          -3.10295257534748, 1.425972706741691, -16.57598866067371,
-          -3.276239931573811, -1.995148786476195, 3.502372446512387,
-          16.50062670924684, 3.479348267192873, 6.813822313911404,
-          -2.234642701444805, -4.571120776660473, -1.507880835141334,
-          -1.62047095951107, -3.564920648690664, -5.428028023658495,
-          -2.863588535286143, -4.282897589581626, 0.8089307276172231,
-          1.216345925982085, 3.771832424523221, -1.764661695165005,
-          6.068607056478453, -2.703454821116731, 1.824319371886537,
-          3.552023642690095, 2.127198741799675, 3.479348267192873,
-          4.73094360865391, 3.277690027890099, -1.356471975117627,
-          -1.65973684528307, 0.2231785103095052, -1.289711081566152,
-          -3.832477684274747, -3.368706027054427, -2.306783229826141,
-          -1.802131403274742, 0.1745311932139862, 0.3342907581563925,
-          3.072975093350886, -1.48764845435588, 2.618649377999702,
-          -6.994707556124125, 0.4318785484492591, 2.608844340193837,
-          2.142680789218174, 6.813822313911404, 3.277690027890099,
-          4.484446465585116;
+      laplace << 14345.89027681351, 28864.6985291772, -628.6887357792988,
+          -2901.263036954509, -9988.632618959329, -15993.10193537083,
+          -32100.05118729315, -26941.03114930365, -27243.32356066365,
+          765.3909385034518, -18064.82971146277, -7744.75222614471,
+          -106986.3331690936, 2165.938147427112, 6659.866136437419,
+          4624.585299901274, 20887.09218798146, 35699.28051300751,
+          93655.39984943235, 40923.86545234417, 28864.6985291772,
+          58083.58590492247, -1265.271289450587, -5839.179332325826,
+          -20100.9865819312, -32181.41519046963, -64592.05034999787,
+          -54212.54550276349, -54819.31156755448, 1541.13198950194,
+          -36346.91019950325, -15583.53276975289, -215281.5224853534,
+          4358.017554577733, 13400.43903226003, 9307.952702124383,
+          42029.22389330126, 71835.27884425361, 188454.7887151434,
+          82347.60810384057, -628.6887357792988, -1265.271289450587,
+          31.77826743413144, 128.771820724893, 438.8403451521691,
+          703.2170270421763, 1411.029272626607, 1183.772796932525,
+          1194.768074773921, -34.51098874263127, 792.3211028569634,
+          339.1639094720845, 4693.533723672438, -96.22804809958089,
+          -296.5904283961138, -204.934522582405, -916.5035486748244,
+          -1566.287663108984, -4111.151226354975, -1797.029889498509,
+          -2901.263036954509, -5839.179332325826, 128.771820724893,
+          589.2174747348388, 2022.300997650935, 3236.674877513037,
+          6496.15935053435, 5452.791231214833, 5511.681576567773,
+          -155.968809621933, 3653.281558102759, 1566.541406440605,
+          21645.83044762318, -438.6890653467754, -1349.458492778741,
+          -938.9267035818817, -4226.130558538282, -7223.213318293821,
+          -18949.78074540154, -8280.640678263891, -9988.632618959329,
+          -20100.9865819312, 438.8403451521691, 2022.300997650935,
+          6960.808157521561, 11141.07962450164, 22358.28398182196,
+          18765.66027149892, 18973.9543823107, -534.0995083272179,
+          12576.21504239621, 5395.028500974826, 74509.72430748165,
+          -1507.841236203997, -4639.386872588645, -3223.680735065853,
+          -14549.09188573473, -24864.84733295712, -65230.03507536754,
+          -28503.29376417496, -15993.10193537083, -32181.41519046963,
+          703.2170270421763, 3236.674877513037, 11141.07962450164,
+          17836.50120363458, 35794.90804442913, 30042.33327336224,
+          30376.72380125829, -854.4278639376096, 20137.91861635344,
+          8636.419030066289, 119288.3085998078, -2414.964743608988,
+          -7428.30276795539, -5159.227269119206, -23291.68926119925,
+          -39806.963593327, -104431.2111863533, -45632.78028662745,
+          -32100.05118729315, -64592.05034999787, 1411.029272626607,
+          6496.15935053435, 22358.28398182196, 35794.90804442913,
+          71840.80585503185, 60295.08509444397, 60967.13248826022,
+          -1714.890878826641, 40420.32308843099, 17332.15184404987,
+          239419.6752833236, -4847.900623958353, -14908.97782251717,
+          -10354.67343620469, -46745.30792515828, -79892.58307920577,
+          -209593.9381836976, -91585.18081609296, -26941.03114930365,
+          -54212.54550276349, 1183.772796932525, 5452.791231214833,
+          18765.66027149892, 30042.33327336224, 60295.08509444397,
+          50606.56939465278, 51169.80290795972, -1439.668295909547,
+          33923.8454592068, 14547.19078646366, 200944.9573513126,
+          -4068.349132871014, -12512.01320902611, -8692.301022390757,
+          -39233.2856625292, -67053.91566764799, -175911.713863976,
+          -76867.18506063022, -27243.32356066365, -54819.31156755448,
+          1194.768074773921, 5511.681576567773, 18973.9543823107,
+          30376.72380125829, 60967.13248826022, 51169.80290795972,
+          51743.60927669165, -1454.299771121, 34303.7751692756,
+          14709.9665384744, 203190.2770010771, -4113.060516494003,
+          -12650.17957016164, -8786.462722806207, -39671.29958812855,
+          -67803.29025801383, -177875.6359886735, -77724.82767303253,
+          765.3909385034518, 1541.13198950194, -34.51098874263127,
+          -155.968809621933, -534.0995083272179, -854.4278639376096,
+          -1714.890878826641, -1439.668295909547, -1454.299771121,
+          43.38968238478899, -964.6739455887714, -412.9140857838196,
+          -5714.879442512749, 116.2652287642805, 355.9737511269957,
+          247.9364102207862, 1115.152820067755, 1906.57159308462,
+          5002.931938851748, 2185.589237865552, -18064.82971146277,
+          -36346.91019950325, 792.3211028569634, 3653.281558102759,
+          12576.21504239621, 20137.91861635344, 40420.32308843099,
+          33923.8454592068, 34303.7751692756, -964.6739455887714,
+          22750.97710881627, 9750.830191637428, 134718.7103676925,
+          -2728.629637331961, -8385.812783410222, -5822.362742404019,
+          -26300.36424793261, -44952.48854582797, -117930.7829002267,
+          -51531.34299108064, -7744.75222614471, -15583.53276975289,
+          339.1639094720845, 1566.541406440605, 5395.028500974826,
+          8636.419030066289, 17332.15184404987, 14547.19078646366,
+          14709.9665384744, -412.9140857838196, 9750.830191637428,
+          4184.767446836197, 57762.21377709172, -1167.995111323621,
+          -3596.152884582992, -2498.18317198207, -11279.64134662282,
+          -19276.02060734549, -50568.28640513688, -22096.79482283177,
+          -106986.3331690936, -215281.5224853534, 4693.533723672438,
+          21645.83044762318, 74509.72430748165, 119288.3085998078,
+          239419.6752833236, 200944.9573513126, 203190.2770010771,
+          -5714.879442512749, 134718.7103676925, 57762.21377709172,
+          797949.0583608233, -16156.32563817581, -49674.79821692743,
+          -34502.4188862103, -155787.9614478133, -266262.6737191005,
+          -698526.4112659337, -305228.9649487849, 2165.938147427112,
+          4358.017554577733, -96.22804809958089, -438.6890653467754,
+          -1507.841236203997, -2414.964743608988, -4847.900623958353,
+          -4068.349132871014, -4113.060516494003, 116.2652287642805,
+          -2728.629637331961, -1167.995111323621, -16156.32563817581,
+          330.8206454406401, 1006.674187697238, 697.9694310481082,
+          3153.524734685643, 5389.150390198342, 14142.29225511536,
+          6179.331178459646, 6659.866136437419, 13400.43903226003,
+          -296.5904283961138, -1349.458492778741, -4639.386872588645,
+          -7428.30276795539, -14908.97782251717, -12512.01320902611,
+          -12650.17957016164, 355.9737511269957, -8385.812783410222,
+          -3596.152884582992, -49674.79821692743, 1006.674187697238,
+          3100.869530358098, 2151.274119243143, 9698.684047996327,
+          16576.0933995983, 43488.52443878541, 19003.27440484149,
+          4624.585299901274, 9307.952702124383, -204.934522582405,
+          -938.9267035818817, -3223.680735065853, -5159.227269119206,
+          -10354.67343620469, -8692.301022390757, -8786.462722806207,
+          247.9364102207862, -5822.362742404019, -2498.18317198207,
+          -34502.4188862103, 697.9694310481082, 2151.274119243143,
+          1498.394963882331, 6736.637938563792, 11513.74835332301,
+          30205.50623714795, 13199.16575689261, 20887.09218798146,
+          42029.22389330126, -916.5035486748244, -4226.130558538282,
+          -14549.09188573473, -23291.68926119925, -46745.30792515828,
+          -39233.2856625292, -39671.29958812855, 1115.152820067755,
+          -26300.36424793261, -11279.64134662282, -155787.9614478133,
+          3153.524734685643, 9698.684047996327, 6736.637938563792,
+          30419.36386312617, 51986.20599741852, 136381.4812218857,
+          59593.90876730521, 35699.28051300751, 71835.27884425361,
+          -1566.287663108984, -7223.213318293821, -24864.84733295712,
+          -39806.963593327, -79892.58307920577, -67053.91566764799,
+          -67803.29025801383, 1906.57159308462, -44952.48854582797,
+          -19276.02060734549, -266262.6737191005, 5389.150390198342,
+          16576.0933995983, 11513.74835332301, 51986.20599741852,
+          88852.63549963493, 233091.1613804788, 101852.1578138308,
+          93655.39984943235, 188454.7887151434, -4111.151226354975,
+          -18949.78074540154, -65230.03507536754, -104431.2111863533,
+          -209593.9381836976, -175911.713863976, -177875.6359886735,
+          5002.931938851748, -117930.7829002267, -50568.28640513688,
+          -698526.4112659337, 14142.29225511536, 43488.52443878541,
+          30205.50623714795, 136381.4812218857, 233091.1613804788,
+          611503.1600163174, 267203.7007879637, 40923.86545234417,
+          82347.60810384057, -1797.029889498509, -8280.640678263891,
+          -28503.29376417496, -45632.78028662745, -91585.18081609296,
+          -76867.18506063022, -77724.82767303253, 2185.589237865552,
+          -51531.34299108064, -22096.79482283177, -305228.9649487849,
+          6179.331178459646, 19003.27440484149, 13199.16575689261,
+          59593.90876730521, 101852.1578138308, 267203.7007879637,
+          116759.4394276741;
       // clang-format on
       for (unsigned i = 0; i < nfunctions; ++i)
         for (unsigned j = 0; j < nfunctions; ++j)